@@ -107,7 +107,10 @@
 
 // The very simple EVE library files
 #include "EVE_defines.h"
+#include "EVE_spi.h"
 #include "EVE_base.h"
+#include "EVE_ram_g.h"
+#include "EVE_math.h"
 #include "EVE_draw.h"
 
 // Our demonstrations of various EVE functions
@@ -129,7 +132,7 @@ void setup()
   SET_SD_CS_NOT;
 
   //Initialize port directions
-  // EVE interrupt output (not used in this example)
+  // EVE interrupt output (open drain, used if EVE_USE_INT_PIN)
   pinMode(EVE_INT, INPUT_PULLUP);
   // EVE Power Down (reset) input
   pinMode(EVE_PD_NOT, OUTPUT);
@@ -172,8 +175,37 @@ void setup()
     {
     DBG_STAT("%s8%02X initialized.\n",EVE_DEVICE<0x14?"FT":"BT",EVE_DEVICE);
     }
+#if (0 != EVE_SPI_BENCHMARK)
+  //Nothing is in RAM_G yet, so it can be used as a scratch pad.
+  EVE_SPI_Benchmark(EVE_RAM_G);
+#endif // (0 != EVE_SPI_BENCHMARK)
+#if (0 != EVE_DRAW_BENCHMARK)
+  //loop() picks up the write pointer from the EVE again.
+  EVE_Draw_Benchmark(EVE_REG_Read_16(EVE_REG_CMD_WRITE));
+#endif // (0 != EVE_DRAW_BENCHMARK)
+#if (0 != EVE_MATH_BENCHMARK)
+  EVE_Math_Benchmark();
+#endif // (0 != EVE_MATH_BENCHMARK)
   } //  setup()
 //===========================================================================
+// The start of every frame: the same no matter what the demos are doing.
+// With STATIC_DL_CACHE this is only sent once, then appended from RAM_G.
+uint16_t Add_Static_To_Display_List(uint16_t FWo)
+  {
+  // Set the default clear color to black
+  FWo=EVE_DL_Dat_0(FWo,
+                   EVE_ENC_CLEAR_COLOR_RGB(0,0,0));
+  // Clear the screen - this and the previous prevent artifacts between lists
+  FWo=EVE_DL_Dat_0(FWo,
+                   EVE_ENC_CLEAR(1 /*CLR_COL*/,1 /*CLR_STN*/,1 /*CLR_TAG*/));
+  //Fill background with white
+  FWo=EVE_Filled_Rectangle(FWo,
+                           0,0,LCD_WIDTH-1,LCD_HEIGHT-1);
+  //Where the demos' images are and what they look like
+  FWo=EVE_Bitmap_Prologue(FWo);
+  return(FWo);
+  }
+//===========================================================================
 void loop()
   {
   DBG_GEEK("Loop initialization.\n");
@@ -184,11 +216,8 @@ void loop()
   FWo = EVE_REG_Read_16(EVE_REG_CMD_WRITE);
   DBG_GEEK("Initial Offest Read: 0x%04X = %u\n",FWo ,FWo);
 
-  //Keep track of the RAM_G memory allocation
-  uint32_t
-    RAM_G_Unused_Start;
-  RAM_G_Unused_Start=0;
-  DBG_GEEK("Initial RAM_G: 0x%08lX = %lu\n",RAM_G_Unused_Start,RAM_G_Unused_Start);
+  //All of RAM_G is free to start with.
+  EVE_RAM_G_Reset();
 
 #if (0 != BOUNCE_DEMO)
   DBG_STAT("Initialize_Bounce_Demo() . . .");
@@ -198,32 +227,51 @@ void loop()
 
 #if (0 != LOGO_DEMO)
   DBG_STAT("Initialize_Logo_Demo() . . .");
-  FWo=Initialize_Logo_Demo(FWo,&RAM_G_Unused_Start);
+  FWo=Initialize_Logo_Demo(FWo);
   DBG_STAT("  done.\n");
-  DBG_GEEK("RAM_G after logo: 0x%08lX = %lu\n",RAM_G_Unused_Start,RAM_G_Unused_Start);
+  EVE_RAM_G_Report(F("After logo"));
 #endif // (0 != LOGO_DEMO)
 
 #if (0 != BMP_DEMO)
   DBG_STAT("Initialize_Bitmap_Demo() . . .");
-  FWo=Initialize_Bitmap_Demo(FWo,&RAM_G_Unused_Start);
+  FWo=Initialize_Bitmap_Demo(FWo);
   DBG_STAT("  done.\n");
-  DBG_GEEK("RAM_G after bitmap: 0x%08lX = %lu\n",RAM_G_Unused_Start,RAM_G_Unused_Start);
+  EVE_RAM_G_Report(F("After bitmap"));
 #endif //(0 != BMP_DEMO)
 
 #if (0 != SOUND_DEMO)
   DBG_STAT("Initialize_Sound_Demo() . . .");
-  FWo=Initialize_Sound_Demo(FWo,&RAM_G_Unused_Start);
+  FWo=Initialize_Sound_Demo(FWo);
   DBG_STAT("  done.\n");
-  DBG_GEEK("RAM_G after sound: 0x%08lX = %lu\n",RAM_G_Unused_Start,RAM_G_Unused_Start);
+  EVE_RAM_G_Report(F("After sound"));
 #endif // (0 != SOUND_DEMO)
 
 #if (0 != MARBLE_DEMO)
   DBG_STAT("Initialize_Marble_Demo() . . .");
-  FWo=Initialize_Marble_Demo(FWo,&RAM_G_Unused_Start);
+  FWo=Initialize_Marble_Demo(FWo);
   DBG_STAT("  done.\n");
-  DBG_GEEK("RAM_G after marble: 0x%08lX = %lu\n",RAM_G_Unused_Start,RAM_G_Unused_Start);
+  EVE_RAM_G_Report(F("After marble"));
 #endif //MARBLE_DEMO
 
+#if (0 != SCENE_DEMO)
+  //The retained-mode screen takes over. It only sends a frame when
+  //something on it changes.
+  DBG_STAT("Initialize_Scene_Demo() . . .");
+  Initialize_Scene_Demo();
+  DBG_STAT("  done.\n");
+  while(1)
+    {
+    FWo=Update_Scene_Demo(FWo);
+    }
+#endif // (0 != SCENE_DEMO)
+
+#if (0 != STATIC_DL_CACHE)
+  //The static part of the frame, kept in RAM_G
+  EVE_DL_Cache
+    Static_DL;
+  EVE_DL_Cache_Initialize(&Static_DL,STATIC_DL_CACHE_SIZE);
+#endif // (0 != STATIC_DL_CACHE)
+
 #if (0 != TOUCH_DEMO)
   //Bitmask of valid points in the array
   uint8_t
@@ -245,6 +293,129 @@ void loop()
 #endif // (EVE_TOUCH_TYPE == EVE_TOUCH_CAPACITIVE)
 #endif // (0 != TOUCH_DEMO)
 
+#if (0 != EVE_SPI_STATISTICS)
+  //Accumulate the SPI cost of building and sending the display list
+  //over a number of frames, then report the average.
+  uint32_t
+    stat_transactions;
+  uint32_t
+    stat_bytes;
+  uint8_t
+    stat_frames;
+  stat_transactions=0;
+  stat_bytes=0;
+  stat_frames=0;
+#endif // (0 != EVE_SPI_STATISTICS)
+
+#if (0 != COPRO_TIME_REPORT)
+  //EVE clocks the coprocessor spent on each frame, summed over a number
+  //of frames.
+  uint32_t
+    copro_clock;
+  uint32_t
+    copro_clocks;
+  uint8_t
+    copro_frames;
+  copro_clocks=0;
+  copro_frames=0;
+#endif // (0 != COPRO_TIME_REPORT)
+
+#if ((0 != DL_STATE_REPORT) && (0 != EVE_DL_STATE_TRACKING))
+  //Display list bytes and commands left out, summed over a number of
+  //frames.
+  uint32_t
+    dl_bytes;
+  uint32_t
+    dl_elided;
+  uint8_t
+    dl_frames;
+  dl_bytes=0;
+  dl_elided=0;
+  dl_frames=0;
+#endif // ((0 != DL_STATE_REPORT) && (0 != EVE_DL_STATE_TRACKING))
+
+#if (0 != FRAME_SKIP)
+#if (0 == EVE_CMD_DRY_RUN)
+#error FRAME_SKIP needs EVE_CMD_DRY_RUN set to 1 in EVE_base.h.
+#endif // (0 == EVE_CMD_DRY_RUN)
+#if (0 != DEBUG_COPROCESSOR_RESET)
+#error DEBUG_COPROCESSOR_RESET loads the logo in the middle of the frame, it cannot be dry run.
+#endif // (0 != DEBUG_COPROCESSOR_RESET)
+  //CRC of the frame the EVE is showing. Only good while frame_crc_valid
+  //is set: anything the CRC does not see (RAM_G contents, a reset of the
+  //coprocessor) has to clear it.
+  uint32_t
+    frame_crc;
+  uint8_t
+    frame_crc_valid;
+  uint32_t
+    frame_dry_crc;
+  uint16_t
+    frame_start;
+  uint8_t
+    frame_skipped;
+#if (0 == FRAME_PACING)
+  uint32_t
+    frame_mark_us;
+#endif // (0 == FRAME_PACING)
+  frame_crc=0;
+  frame_crc_valid=0;
+  //No CMD_SWAP has gone out from the loop yet.
+  frame_skipped=1;
+#if (0 == FRAME_PACING)
+  frame_mark_us=micros();
+#endif // (0 == FRAME_PACING)
+#if (0 != FRAME_SKIP_REPORT)
+  //Frames skipped and bytes not sent, over a number of frames.
+  uint32_t
+    skip_bytes;
+  uint8_t
+    skip_skipped;
+  uint8_t
+    skip_frames;
+  skip_bytes=0;
+  skip_skipped=0;
+  skip_frames=0;
+#endif // (0 != FRAME_SKIP_REPORT)
+#endif // (0 != FRAME_SKIP)
+
+#if (0 != OVERLAP_FRAME_WAIT)
+  uint8_t
+    copro_status;
+  //Nothing is queued, so the first poll below will find the EVE idle.
+  EVE_Copro_Start(FWo,OVERLAP_FRAME_BUDGET_MS);
+#if (0 != OVERLAP_FRAME_TIMING)
+  //Time spent doing our own work while the EVE was busy, vs time spent
+  //just waiting for it, summed over a number of frames.
+  uint32_t
+    timing_mark_us;
+  uint32_t
+    timing_overlap_us;
+  uint32_t
+    timing_wait_us;
+  uint8_t
+    timing_frames;
+  timing_mark_us=micros();
+  timing_overlap_us=0;
+  timing_wait_us=0;
+  timing_frames=0;
+#endif // (0 != OVERLAP_FRAME_TIMING)
+#endif // (0 != OVERLAP_FRAME_WAIT)
+
+#if (0 != FRAME_PACING)
+  //Ticks since the last frame, the number of steps the demos take.
+  uint8_t
+    pace_ticks;
+#if (0 != FRAME_PACING_REPORT)
+  uint8_t
+    pace_frames;
+  pace_frames=0;
+  DBG_STAT("Display refresh: %.3lk Hz, target %.3lk fps\n",
+           EVE_Frame_Rate_mHz(),EVE_Frame_Rate_mHz()/FRAME_PACING_DIVIDER);
+#endif // (0 != FRAME_PACING_REPORT)
+  EVE_Frame_Pace_Start(FRAME_PACING_DIVIDER,FRAME_PACING_MAX_TICKS);
+#endif // (0 != FRAME_PACING)
+
   DBG_STAT("Initialization complete, entering main loop.\n");
 
   while(1)
@@ -260,7 +431,9 @@ void loop()
     //
     // If possible, I have tweaked the timing on the Crystalfontz displays
     // to all have ~60Hz frame rate.
+#if (0 == OVERLAP_FRAME_WAIT)
     FWo=Wait_for_EVE_Execution_Complete(FWo);
+#endif // (0 == OVERLAP_FRAME_WAIT)
 
 #if TOUCH_DEMO
     //Read the touch screen.
@@ -275,21 +448,153 @@ void loop()
     Start_Sound_Demo_Playing();
 #endif //SOUND_DEMO
 
+#if (0 != OVERLAP_FRAME_WAIT)
+    //The demo physics at the bottom of the loop, and the touch and sound
+    //above, only touch registers, so they ran while the EVE was still
+    //busy with the last frame. Now finish waiting for it.
+#if (0 != OVERLAP_FRAME_TIMING)
+    timing_overlap_us+=micros()-timing_mark_us;
+    timing_mark_us=micros();
+#endif // (0 != OVERLAP_FRAME_TIMING)
+    do
+      {
+      copro_status=EVE_Copro_Poll();
+      } while(EVE_COPRO_BUSY == copro_status);
+#if (0 != OVERLAP_FRAME_TIMING)
+    timing_wait_us+=micros()-timing_mark_us;
+    timing_frames++;
+    if(64 == timing_frames)
+      {
+      DBG_STAT("Per frame: %lu us overlapped with the EVE, %lu us waiting\n",
+               timing_overlap_us/64,timing_wait_us/64);
+      timing_overlap_us=0;
+      timing_wait_us=0;
+      timing_frames=0;
+      }
+#endif // (0 != OVERLAP_FRAME_TIMING)
+    if(EVE_COPRO_DONE != copro_status)
+      {
+      DBG_STAT("Coprocessor did not finish the frame, resetting it.\n");
+      FWo=Reset_EVE_Coprocessor();
+      //RAM_G outlives the reset, but the fault may have scribbled on it.
+      //Only what no longer matches its CRC comes off the uSD again.
+      FWo=Reload_Demo_Assets(FWo);
+#if (0 != STATIC_DL_CACHE)
+      EVE_DL_Cache_Invalidate(&Static_DL);
+#endif // (0 != STATIC_DL_CACHE)
+#if (0 != FRAME_SKIP)
+      frame_crc_valid=0;
+#endif // (0 != FRAME_SKIP)
+      }
+#endif // (0 != OVERLAP_FRAME_WAIT)
+
+#if (0 != FRAME_PACING)
+    //========== FRAME PACING ==========
+    //The EVE is done, now wait for the display to get to the next tick.
+    //If this frame took longer than that, it does not wait at all, and
+    //the demos take more than one step at the bottom of the loop.
+#if (0 != FRAME_SKIP)
+    //A skipped frame sent no CMD_SWAP, so there is no swap to wake us.
+    pace_ticks=EVE_Frame_Pace_Wait(!frame_skipped);
+#else
+    pace_ticks=EVE_Frame_Pace_Wait(1);
+#endif // (0 != FRAME_SKIP)
+#if (0 != FRAME_PACING_REPORT)
+    pace_frames++;
+    if(64 == pace_frames)
+      {
+      DBG_STAT("Of the last 64 frames: %u dropped, %u ticks lost\n",
+               EVE_Frame_Pace_Dropped,EVE_Frame_Pace_Lost);
+      EVE_Frame_Pace_Dropped=0;
+      EVE_Frame_Pace_Lost=0;
+      pace_frames=0;
+      }
+#endif // (0 != FRAME_PACING_REPORT)
+#endif // (0 != FRAME_PACING)
+
+#if (0 != EVE_SPI_STATISTICS)
+    //Only count the traffic from here to the EVE_Cmd_Flush() below.
+    EVE_SPI_Transactions=0;
+    EVE_SPI_Bytes=0;
+#endif // (0 != EVE_SPI_STATISTICS)
+
+#if ((0 != DL_STATE_REPORT) && (0 != EVE_DL_STATE_TRACKING))
+    //========== REPORT THE DISPLAY LIST SIZE ==========
+    //The EVE is done with the last frame, so this is how much of RAM_DL
+    //it took.
+    dl_bytes+=EVE_REG_Read_16(EVE_REG_CMD_DL);
+    dl_elided+=EVE_DL_Elided;
+    dl_frames++;
+    if(64 == dl_frames)
+      {
+      DBG_STAT("Display list per frame: %lu of %u bytes, %lu commands left out\n",
+               dl_bytes/64,(uint16_t)EVE_RAM_DL_SIZE,dl_elided/64);
+      dl_bytes=0;
+      dl_elided=0;
+      dl_frames=0;
+      }
+#endif // ((0 != DL_STATE_REPORT) && (0 != EVE_DL_STATE_TRACKING))
+
+#if (0 != STATIC_DL_CACHE)
+    if(EVE_DL_Cache_Needs_Record(&Static_DL))
+      {
+      //First time, or something in it changed. Build it again.
+      FWo=EVE_DL_Cache_Record_Start(FWo);
+      FWo=Add_Static_To_Display_List(FWo);
+      FWo=EVE_DL_Cache_Record_End(FWo,&Static_DL);
+#if (0 != FRAME_SKIP)
+      //The CMD_APPEND in the frame stays the same, what it pulls in does not.
+      frame_crc_valid=0;
+#endif // (0 != FRAME_SKIP)
+      }
+#endif // (0 != STATIC_DL_CACHE)
+
+#if (0 != REMOTE_BACKLIGHT_DEBUG)
+    int
+      byte_read;
+    if(-1 != (byte_read=Serial.read()))
+      {
+      DBG_GEEK("Serial Data Read: %3d 0x%02X",byte_read,byte_read);
+      if(byte_read<=128)
+        {
+        EVE_REG_Write_8(EVE_REG_PWM_DUTY,byte_read);
+        DBG_GEEK(", backlight set.");
+        }
+      DBG_GEEK("\n");
+      }
+#endif // (0 != REMOTE_BACKLIGHT_DEBUG)
+
     //========== START THE DISPLAY LIST ==========
+#if (0 != FRAME_SKIP)
+    //Everything from here to the CMD_SWAP runs twice: first as a dry run
+    //that only works out the CRC, then (if that is new) for real. So none
+    //of it may change anything, the demos step along at the bottom of the
+    //loop.
+    frame_start=FWo;
+    frame_skipped=0;
+    EVE_Cmd_Dry_Run_Start();
+    while(1)
+      {
+#endif // (0 != FRAME_SKIP)
+#if (0 != EVE_DL_STATE_TRACKING)
+    EVE_DL_Elided=0;
+#endif // (0 != EVE_DL_STATE_TRACKING)
     // Start the display list
-    FWo=EVE_Cmd_Dat_0(FWo,
-                      (EVE_ENC_CMD_DLSTART));
+    FWo=EVE_DL_Dat_0(FWo,
+                     (EVE_ENC_CMD_DLSTART));
   
-    // Set the default clear color to black
-    FWo=EVE_Cmd_Dat_0(FWo,
-                      EVE_ENC_CLEAR_COLOR_RGB(0,0,0));
-    // Clear the screen - this and the previous prevent artifacts between lists
-    FWo=EVE_Cmd_Dat_0(FWo,
-                      EVE_ENC_CLEAR(1 /*CLR_COL*/,1 /*CLR_STN*/,1 /*CLR_TAG*/));
+    //Clear and fill the background
+#if (0 != STATIC_DL_CACHE)
+    if(EVE_DL_Cache_Is_Valid(&Static_DL))
+      {
+      FWo=EVE_DL_Cache_Append(FWo,&Static_DL);
+      }
+    else
+#endif // (0 != STATIC_DL_CACHE)
+      {
+      FWo=Add_Static_To_Display_List(FWo);
+      }
     //========== ADD GRAPHIC ITEMS TO THE DISPLAY LIST ==========
-    //Fill background with white
-    FWo=EVE_Filled_Rectangle(FWo,
-                             0,0,LCD_WIDTH-1,LCD_HEIGHT-1);
 #if (0 != BMP_DEMO)
     FWo=Add_Bitmap_To_Display_List(FWo);
 #endif // BMP_DEMO
@@ -325,18 +630,22 @@ void loop()
             //Test code to crash coprocessor ever other time it is called --
             //for testing Reset_EVE_Coprocessor()
             DBG_STAT("Initialize_Logo_Demo() . . .");
-            FWo=Initialize_Logo_Demo(FWo,&RAM_G_Unused_Start);
+            FWo=Initialize_Logo_Demo(FWo);
             DBG_STAT("  done.\n");
+#if (0 != STATIC_DL_CACHE)
+            //The logo moved in RAM_G.
+            EVE_DL_Cache_Invalidate(&Static_DL);
+#endif // (0 != STATIC_DL_CACHE)
 #endif // (0!=DEBUG_COPROCESSOR_RESET)
             }
           else
             {
 #endif // (0 != MARBLE_DEMO)
-            FWo=EVE_Cmd_Dat_0(FWo,
-                                colors[i]);
+            FWo=EVE_DL_Dat_0(FWo,
+                               colors[i]);
             // Make it solid
-            FWo=EVE_Cmd_Dat_0(FWo,
-                                EVE_ENC_COLOR_A(0xFF));
+            FWo=EVE_DL_Dat_0(FWo,
+                               EVE_ENC_COLOR_A(0xFF));
             // Draw the touch dot -- a 40px point (filled circle)
             FWo=EVE_Point(FWo,
                             x_points[i]*16,
@@ -345,9 +654,9 @@ void loop()
 #if (0 != MARBLE_DEMO)
             }
 #endif // (0 != MARBLE_DEMO)
-          //Tag the touch point with magenta text to show off EVE_PrintF.
-          FWo=EVE_Cmd_Dat_0(FWo,
-                            EVE_ENC_COLOR_RGB(0xFF,0x00,0xFF));
+          //Tag the touch point with its coordinates in magenta.
+          FWo=EVE_DL_Dat_0(FWo,
+                           EVE_ENC_COLOR_RGB(0xFF,0x00,0xFF));
           //Move the the text out from under the user's finger
           int16_t
             xoffset;
@@ -369,15 +678,19 @@ void loop()
              {
              yoffset=-40;
              }
-          //Put the text into the display list
-          FWo=EVE_PrintF(FWo,
-                         x_points[i]+xoffset,
+          //The coprocessor formats the numbers, x to the left of the
+          //label's center and y to the right of it.
+          FWo=EVE_Number(FWo,
+                         x_points[i]+xoffset-6,
+                         y_points[i]+yoffset,
+                         27,         //Font
+                         EVE_OPT_RIGHTX|EVE_OPT_CENTERY|EVE_OPT_SIGNED,
+                         x_points[i]);
+          FWo=EVE_Number(FWo,
+                         x_points[i]+xoffset+6,
                          y_points[i]+yoffset,
                          27,         //Font
-                         EVE_OPT_CENTER, //Options
-                         "T[%d]@(%d,%d)",
-                         i+1,
-                         x_points[i],
+                         EVE_OPT_CENTERY|EVE_OPT_SIGNED,
                          y_points[i]);
                       
           }
@@ -414,29 +727,114 @@ void loop()
     FWo=Add_Logo_To_Display_List(FWo);
 #endif // (0 != LOGO_DEMO)
 
-#if (0 != REMOTE_BACKLIGHT_DEBUG)
-    int
-      byte_read;
-    if(-1 != (byte_read=Serial.read()))
+    //========== FINSH AND SHOW THE DISPLAY LIST ==========
+    // Instruct the graphics processor to show the list
+    FWo=EVE_DL_Dat_0(FWo, EVE_ENC_DISPLAY());
+    // Make this list active
+    FWo=EVE_Cmd_Dat_0(FWo, EVE_ENC_CMD_SWAP);
+#if (0 != FRAME_SKIP)
+      if(0 == EVE_Cmd_Dry_Running)
+        {
+        //That was the real thing.
+        break;
+        }
+      //The dry run did not use any of RAM_CMD.
+      FWo=frame_start;
+      frame_dry_crc=EVE_Cmd_Dry_Run_End();
+      if((0 != frame_crc_valid) && (frame_dry_crc == frame_crc))
+        {
+        //Same as the frame on the screen, nothing to send.
+        frame_skipped=1;
+        break;
+        }
+      frame_crc=frame_dry_crc;
+      frame_crc_valid=1;
+      }
+#if (0 != FRAME_SKIP_REPORT)
+    //========== REPORT THE FRAMES SKIPPED ==========
+    if(0 != frame_skipped)
       {
-      DBG_GEEK("Serial Data Read: %3d 0x%02X",byte_read,byte_read);
-      if(byte_read<=128)
+      skip_bytes+=EVE_Cmd_Dry_Run_Bytes;
+      skip_skipped++;
+      }
+    skip_frames++;
+    if(64 == skip_frames)
+      {
+      DBG_STAT("Frames skipped: %u of 64, %lu bytes not sent\n",
+               skip_skipped,skip_bytes);
+      skip_bytes=0;
+      skip_skipped=0;
+      skip_frames=0;
+      }
+#endif // (0 != FRAME_SKIP_REPORT)
+    if(0 != frame_skipped)
+      {
+#if (0 == FRAME_PACING)
+      //Nothing for the EVE to do, so nothing to wait for either. Take as
+      //long as a frame would have.
+      while((uint32_t)(micros()-frame_mark_us) < FRAME_SKIP_PERIOD_US)
         {
-        EVE_REG_Write_8(EVE_REG_PWM_DUTY,byte_read);
-        DBG_GEEK(", backlight set.");
         }
-      DBG_GEEK("\n");
+      frame_mark_us=micros();
+#endif // (0 == FRAME_PACING)
       }
-#endif // (0 != REMOTE_BACKLIGHT_DEBUG)
+    else
+      {
+#if (0 == FRAME_PACING)
+      frame_mark_us=micros();
+#endif // (0 == FRAME_PACING)
+#endif // (0 != FRAME_SKIP)
+#if (0 != COPRO_TIME_REPORT)
+    copro_clock=EVE_REG_Read_32(EVE_REG_CLOCK);
+#endif // (0 != COPRO_TIME_REPORT)
+    // Get the graphics processor executing the list
+    EVE_Cmd_Flush(FWo);
+#if (0 != COPRO_TIME_REPORT)
+    //========== REPORT THE COPROCESSOR TIME ==========
+    //Wait for it right here, so the count is just the coprocessor's work.
+    FWo=Wait_for_EVE_Execution_Complete(FWo);
+    copro_clocks+=EVE_REG_Read_32(EVE_REG_CLOCK)-copro_clock;
+    copro_frames++;
+    if(64 == copro_frames)
+      {
+      DBG_STAT("Coprocessor per frame: %lu clocks\n",copro_clocks/64);
+      copro_clocks=0;
+      copro_frames=0;
+      }
+#endif // (0 != COPRO_TIME_REPORT)
+#if (0 != OVERLAP_FRAME_WAIT)
+    //Start watching for the EVE to finish, without waiting for it.
+    EVE_Copro_Start(FWo,OVERLAP_FRAME_BUDGET_MS);
+#if (0 != OVERLAP_FRAME_TIMING)
+    timing_mark_us=micros();
+#endif // (0 != OVERLAP_FRAME_TIMING)
+#endif // (0 != OVERLAP_FRAME_WAIT)
+#if (0 != FRAME_SKIP)
+      }
+#endif // (0 != FRAME_SKIP)
 
-    //========== FINSH AND SHOW THE DISPLAY LIST ==========
-    // Instruct the graphics processor to show the list
-    FWo=EVE_Cmd_Dat_0(FWo, EVE_ENC_DISPLAY());
-    // Make this list active
-    FWo=EVE_Cmd_Dat_0(FWo, EVE_ENC_CMD_SWAP);
-    // Update the ring buffer pointer so the graphics processor starts executing
-    EVE_REG_Write_16(EVE_REG_CMD_WRITE, (FWo));
+#if (0 != EVE_SPI_STATISTICS)
+    //========== REPORT THE SPI COST OF THE DISPLAY LIST ==========
+    stat_transactions+=EVE_SPI_Transactions;
+    stat_bytes+=EVE_SPI_Bytes;
+    stat_frames++;
+    if(64 == stat_frames)
+      {
+      DBG_STAT("Display list SPI per frame: %lu transactions, %lu bytes\n",
+               stat_transactions/64,stat_bytes/64);
+      stat_transactions=0;
+      stat_bytes=0;
+      stat_frames=0;
+      }
+#endif // (0 != EVE_SPI_STATISTICS)
 
+#if (0 != FRAME_PACING)
+    //========== STEP THE DEMOS ==========
+    //Once for every tick since the last frame.
+    while(0 != pace_ticks)
+      {
+      pace_ticks--;
+#endif // (0 != FRAME_PACING)
 #if (0 != BOUNCE_DEMO)
     //========== MOVE THE BALL AND CYCLE COLOR AND TRANSPARENCY ==========
     Bounce_Ball();
@@ -446,6 +844,19 @@ void loop()
   //========== BOUNCE THE MARBLE AROUND ==========
   Move_Marble();
 #endif //(0 != MARBLE_DEMO)
+
+#if ((0 != BMP_DEMO) && (1 == BMP_SCROLL))
+    //========== SLIDE THE BACKGROUND ALONG ==========
+    Scroll_Bitmap();
+#endif // ((0 != BMP_DEMO) && (1 == BMP_SCROLL))
+
+#if (0 != LOGO_DEMO)
+    //========== SPIN THE LOGO ==========
+    Spin_Logo();
+#endif // (0 != LOGO_DEMO)
+#if (0 != FRAME_PACING)
+      }
+#endif // (0 != FRAME_PACING)
     }  // while(1)
   } // loop()
 //===========================================================================
@@ -65,15 +65,32 @@
 #define BT816 (0x16)
 #define BT817 (0x17)
 #define BT818 (0x18)
+
+//My defines for the SPI transport, see EVE_spi.h
+#define EVE_SPI_ARDUINO (0)
+#define EVE_SPI_SPIDEV  (1)
+#define EVE_SPI_RECORD  (2)
 //============================================================================
 // These defines describe the board and EVE accelerator.
+//(host/Makefile builds the allocator test for other devices.)
+#if !defined(EVE_DEVICE)
 #define EVE_DEVICE           (FT811)
+#endif // !defined(EVE_DEVICE)
 #define EVE_CLOCK_SOURCE     (EVE_CLOCK_SOURCE_INTERNAL)
 #define EVE_CLOCK_MUL        (EVE_EXTERNAL_CLOCK_MUL_UNUSED)
 #define EVE_CLOCK_SPEED      ((uint32_t)60000000)
 #define EVE_TOUCH_TYPE       (EVE_TOUCH_CAPACITIVE)
 #define EVE_TOUCH_CAP_DEVICE (EVE_CAP_DEV_DEFAULT)
 #define EVE_PEN_UP_BUG_FIX   (0)
+//Talk to the EVE through the Arduino SPI library, unless this is an
+//off-target build (which can also pick EVE_SPI_SPIDEV on the command line).
+#if !defined(EVE_SPI_TRANSPORT)
+#if defined(ARDUINO)
+#define EVE_SPI_TRANSPORT    (EVE_SPI_ARDUINO)
+#else
+#define EVE_SPI_TRANSPORT    (EVE_SPI_RECORD)
+#endif // defined(ARDUINO)
+#endif // !defined(EVE_SPI_TRANSPORT)
 //Touch panel defaults to 480x128 -- no calibration needed.
 #define EVE_TOUCH_CAL_NEEDED (0)
 // DEBUG_NONE (0K flash), DEBUG_STATUS (~1.4K flash) or DEBUG_GEEK (~5.9K flash)
@@ -81,13 +98,15 @@
 
 // You can enable/disable the different demos here.
 // There is not enough RAM_G space to hold all of the scrolling background,
-// logo, audio, and blue marble at the same time.
+// logo, audio, and blue marble at the same time. Whatever does not fit
+// is left out, see EVE_RAM_G_Alloc() in EVE_ram_g.h.
 // Also, some combinations of demos and debug messages may overflow the
 // Seeeduino / Arduino flash. The symptom will be a programming error
 // from AVRdude.
 
 #define BMP_DEMO             (0)  //Background, uses uSD
 #define   BMP_SCROLL         (0)  //1=scrolling background, 0=static image
+#define   BMP_INFLATE        (1)  //1=.Z file inflated by the EVE, 0=.RAW
 #define SOUND_DEMO           (0)  //Uses uSD
 #define   SOUND_VOICE        (0)  //1=VOI_8K.RAW, 0=MUS_8K.RAW
 #define   SOUND_PLAY_TIMES   (10)
@@ -96,6 +115,7 @@
 #define BOUNCE_DEMO          (1)  //Ball-and-rubber-band demo.
 #define MARBLE_DEMO          (0)  //Uses uSD - spinning earth
 #define TOUCH_DEMO           (0)
+#define SCENE_DEMO           (0)  //Retained-mode screen (EVE_scene), replaces the rest
 //============================================================================
 // Turn on uSD code if one of the demos above uses it.
 #if ((0 != SOUND_DEMO) || (0 != BMP_DEMO) || (0 != MARBLE_DEMO))
@@ -144,6 +164,73 @@
 #define DEBUG_COPROCESSOR_RESET (0)
 #endif // ((0 != LOGO_DEMO) &&( 1 == LOGO_PNG_0_ARGB2_1))
 //============================================================================
+// Let loop() read the touch screen and step the demos while the EVE is
+// still drawing the previous frame, only waiting for it (with
+// EVE_Copro_Poll()) right before the next display list is built.
+// Set to 0 to wait first with Wait_for_EVE_Execution_Complete().
+#define OVERLAP_FRAME_WAIT      (1)
+// How long a frame may take before the coprocessor is assumed stuck
+#define OVERLAP_FRAME_BUDGET_MS (250)
+// Report how much time per frame was overlapped with the EVE (debug only).
+#if (0 != OVERLAP_FRAME_WAIT)
+#define OVERLAP_FRAME_TIMING    (0)
+#endif // (0 != OVERLAP_FRAME_WAIT)
+//============================================================================
+// Build the part of the frame that never changes (clear, background,
+// logo bitmap setup) once, keep a copy in RAM_G and pull it into every
+// frame with a single CMD_APPEND.
+#define STATIC_DL_CACHE         (1)
+// RAM_G reserved for it, in bytes.
+#define STATIC_DL_CACHE_SIZE    (256)
+//============================================================================
+// Report the display list size and how many commands the graphics state
+// tracker in EVE_draw (EVE_DL_STATE_TRACKING) left out (debug only).
+#define DL_STATE_REPORT         (0)
+//============================================================================
+// Work out the logo and marble rotations on the MCU (EVE_math) and send
+// them as BITMAP_TRANSFORM_A..F, instead of having the coprocessor run
+// CMD_LOADIDENTITY, CMD_TRANSLATE, CMD_ROTATE and CMD_SETMATRIX.
+#define HOST_BITMAP_TRANSFORM   (1)
+// Report how long the coprocessor takes over each frame, in EVE clocks
+// (REG_CLOCK). It waits for the coprocessor right after the frame is
+// sent, so only use it to measure (debug only).
+#define COPRO_TIME_REPORT       (0)
+//============================================================================
+// Build each frame twice: first as a dry run (EVE_CMD_DRY_RUN in
+// EVE_base.h) that only works out the CRC of its commands, then for real,
+// but only if the CRC is not the same as the last frame's. A screen that
+// is not changing then costs no SPI traffic and no CMD_SWAP at all.
+// Needs EVE_CMD_DRY_RUN set to 1.
+#define FRAME_SKIP              (0)
+// Without FRAME_PACING, how long a skipped frame takes instead, so the
+// demos still step along at the ~60Hz frame rate.
+#define FRAME_SKIP_PERIOD_US    (16667)
+// Report the frames skipped and the bytes that saved (debug only).
+#if (0 != FRAME_SKIP)
+#define FRAME_SKIP_REPORT       (0)
+#endif // (0 != FRAME_SKIP)
+//============================================================================
+// Pace loop() by the display's own frame counter (EVE_REG_FRAMES) and
+// step the demos once for every tick that went by, so the ball, marble
+// and logo keep their speed when a frame takes too long to build. The
+// display just shows the last frame again in the meantime.
+#define FRAME_PACING            (1)
+// Target frame rate: the refresh rate (~60Hz) divided by this.
+#define FRAME_PACING_DIVIDER    (1)
+// Most ticks to catch up on at once. After a longer stall the demos just
+// carry on from where they were.
+#define FRAME_PACING_MAX_TICKS  (4)
+// Report the refresh rate, and the frames dropped (debug only).
+#if (0 != FRAME_PACING)
+#define FRAME_PACING_REPORT     (0)
+#endif // (0 != FRAME_PACING)
+//============================================================================
+// Print each uSD file's load speed, and how much of the time went on the
+// uSD and how much on the EVE (debug only).
+#if (0 != BUILD_SD)
+#define EVE_LOAD_REPORT         (0)
+#endif // (0 != BUILD_SD)
+//============================================================================
 // Wiring for prototypes.
 //   ARD      | Port | 10098/EVE           | Color
 // -----------+------+---------------------|--------
@@ -157,7 +244,7 @@
 // #13/D13    |  PB5 | SCK  (hardware SPI) | orange
 
 //Arduino style pin defines
-// Interrupt from EVE to Arduino - input, not used in this example.
+// Interrupt from EVE to Arduino - input, active low.
 #define EVE_INT     (7)
 // PD_N from Arduino to EVE - effectively EVE reset
 #define EVE_PD_NOT  (8)
@@ -168,6 +255,16 @@
 // Debug LED, or used for scope trigger or precise timing
 #define DEBUG_LED   (3)
 
+// Wait for the EVE to pull EVE_INT low when the coprocessor runs out of
+// commands, instead of polling EVE_REG_CMD_READ over the SPI bus. Set to
+// 0 to go back to polling (for instance if EVE_INT is not wired). Off the
+// target there is no pin, so always poll.
+#if (EVE_SPI_TRANSPORT == EVE_SPI_ARDUINO)
+#define EVE_USE_INT_PIN (1)
+#else
+#define EVE_USE_INT_PIN (0)
+#endif // (EVE_SPI_TRANSPORT == EVE_SPI_ARDUINO)
+
 #if defined(__AVR__)
 //Faster direct port access (specific to AVR)
 #define CLR_EVE_PD_NOT        (PORTB &= ~(0x01))
@@ -184,6 +281,7 @@
 // #define SET_SCK               (PORTB |=  (0x20))
 #define CLR_DEBUG_LED         (PORTD &= ~(0x08))
 #define SET_DEBUG_LED         (PORTD |=  (0x08))
+#define EVE_INT_ASSERTED      (0 == (PIND & 0x80))
 #else
 #define CLR_EVE_PD_NOT        digitalWrite(EVE_PD_NOT, LOW)
 #define SET_EVE_PD_NOT        digitalWrite(EVE_PD_NOT, HIGH)
@@ -199,6 +297,7 @@
 // #define SET_SCK               (PORTB |=  (0x20))
 #define CLR_DEBUG_LED         digitalWrite(DEBUG_LED, LOW)
 #define SET_DEBUG_LED         digitalWrite(DEBUG_LED, HIGH)
+#define EVE_INT_ASSERTED      (LOW == digitalRead(EVE_INT))
 
 #endif
 //============================================================================
@@ -85,28 +85,259 @@
 #include "CFA10099_defines.h"
 #include "CFA480128Ex_039Tx.h"
 
+#if ((0 != EVE_USE_INT_PIN) && defined(__AVR__))
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#endif // ((0 != EVE_USE_INT_PIN) && defined(__AVR__))
+
 #include "EVE_defines.h"
+#include "EVE_spi.h"
 #include "EVE_base.h"
+#include "EVE_math.h"
 #include "EVE_draw.h"
 //============================================================================
+// Pad out to width with count characters already written.
+static void _EVE_Format_Pad(EVE_Format_Output output,
+                            char pad,
+                            uint8_t width,
+                            uint8_t count)
+  {
+  while(count < width)
+    {
+    output(pad);
+    count++;
+    }
+  }
+//----------------------------------------------------------------------------
+void EVE_Format(EVE_Format_Output output,
+                const __FlashStringHelper *fmt,
+                va_list args)
+  {
+  const char
+    *format;
+  char
+    c;
+  uint8_t
+    left;
+  char
+    pad;
+  uint8_t
+    width;
+  uint8_t
+    precision;
+  uint8_t
+    is_long;
+  const char
+    *string;
+  uint8_t
+    negative;
+  uint32_t
+    value;
+  uint8_t
+    base;
+  uint8_t
+    digit;
+  //Numbers are built here backwards: up to 10 digits of a 32-bit
+  //number, and the point of %k.
+  char
+    digits[11];
+  uint8_t
+    length;
+  uint8_t
+    count;
+
+  format=(const char *)fmt;
+  while(0 != (c=pgm_read_byte(format++)))
+    {
+    if('%' != c)
+      {
+      output(c);
+      continue;
+      }
+    //Flags, width, precision and size.
+    left=0;
+    pad=' ';
+    width=0;
+    precision=0;
+    is_long=0;
+    c=pgm_read_byte(format++);
+    while(('-' == c)||('0' == c))
+      {
+      if('-' == c)
+        {
+        left=1;
+        }
+      else
+        {
+        pad='0';
+        }
+      c=pgm_read_byte(format++);
+      }
+    if('*' == c)
+      {
+      width=(uint8_t)va_arg(args,int);
+      c=pgm_read_byte(format++);
+      }
+    while(('0' <= c)&&(c <= '9'))
+      {
+      width=width*10+(c-'0');
+      c=pgm_read_byte(format++);
+      }
+    if('.' == c)
+      {
+      c=pgm_read_byte(format++);
+      if('*' == c)
+        {
+        precision=(uint8_t)va_arg(args,int);
+        c=pgm_read_byte(format++);
+        }
+      while(('0' <= c)&&(c <= '9'))
+        {
+        precision=precision*10+(c-'0');
+        c=pgm_read_byte(format++);
+        }
+      }
+    if('l' == c)
+      {
+      is_long=1;
+      c=pgm_read_byte(format++);
+      }
+    if(0 == c)
+      {
+      //Format ended in the middle of a conversion.
+      break;
+      }
+
+    if(('s' == c)||('S' == c))
+      {
+      //Strings go straight through, from RAM or from flash.
+      string=va_arg(args,const char *);
+      length=('s' == c)?strlen(string):strlen_P(string);
+      if(0 == left)
+        {
+        _EVE_Format_Pad(output,' ',width,length);
+        }
+      if('s' == c)
+        {
+        while(0 != *string)
+          {
+          output(*string++);
+          }
+        }
+      else
+        {
+        while(0 != (digit=pgm_read_byte(string++)))
+          {
+          output((char)digit);
+          }
+        }
+      if(0 != left)
+        {
+        _EVE_Format_Pad(output,' ',width,length);
+        }
+      continue;
+      }
+
+    //Everything else is a number (or a single character).
+    negative=0;
+    base=10;
+    length=0;
+    //%l is for uint32_t and int32_t, which are long on the AVR.
+    switch(c)
+      {
+      case 'd':
+      case 'i':
+      case 'k':
+        {
+        int32_t
+          signed_value;
+        signed_value=is_long?va_arg(args,int32_t):(int32_t)va_arg(args,int);
+        if(signed_value < 0)
+          {
+          negative=1;
+          }
+        value=negative?-(uint32_t)signed_value:(uint32_t)signed_value;
+        break;
+        }
+      case 'u':
+        value=is_long?va_arg(args,uint32_t):(uint32_t)va_arg(args,unsigned int);
+        break;
+      case 'x':
+      case 'X':
+        value=is_long?va_arg(args,uint32_t):(uint32_t)va_arg(args,unsigned int);
+        base=16;
+        break;
+      case 'c':
+        digits[0]=(char)va_arg(args,int);
+        length=1;
+        break;
+      default:
+        //%% and anything unknown.
+        output(c);
+        continue;
+      }
+    if(0 == length)
+      {
+      if(('k' != c)||(9 < precision))
+        {
+        //Only %k has a point, with at most 9 digits after it.
+        precision=('k' == c)?9:0;
+        }
+      do
+        {
+        if((0 != precision)&&(length == precision))
+          {
+          digits[length++]='.';
+          }
+        digit=value%base;
+        value/=base;
+        digits[length++]=(digit < 10)?('0'+digit):((('x' == c)?'a':'A')+digit-10);
+        } while((0 != value)||(length <= precision));
+      }
+
+    //Zeros go between the sign and the digits, spaces outside both.
+    count=length+negative;
+    if((0 == left)&&(' ' == pad))
+      {
+      _EVE_Format_Pad(output,' ',width,count);
+      }
+    if(0 != negative)
+      {
+      output('-');
+      }
+    if((0 == left)&&('0' == pad))
+      {
+      _EVE_Format_Pad(output,'0',width,count);
+      }
+    while(0 != length)
+      {
+      output(digits[--length]);
+      }
+    if(0 != left)
+      {
+      _EVE_Format_Pad(output,' ',width,count);
+      }
+    }
+  }
+//============================================================================
+static void _SerPrint_Output(char c)
+  {
+  Serial.write((uint8_t)c);
+  }
+//----------------------------------------------------------------------------
 // Don't call SerPrintFF() directly, use DBG_STAT() or DBG_GEEK() macros.
 //
-// ref http://playground.arduino.cc/Main/Printf
-//
 // Example to dump a uint32_t in hex and decimal
 //   SerPrintFF(F("RAM_G_Unused_Start: 0x%08lX = %lu\n"),RAM_G_Unused_Start,RAM_G_Unused_Start);
 // Example to dump a uint16_t in hex and decimal
 //   SerPrintFF(F("Initial Offest Read: 0x%04X = %u\n"),FWo ,FWo);
 void SerPrintFF(const __FlashStringHelper *fmt, ... )
   {
-  char
-    tmp[128]; // resulting string limited to 128 chars
   va_list
     args;
   va_start(args, fmt );
-  vsnprintf_P(tmp, 128, (const char *)fmt, args);
+  EVE_Format(_SerPrint_Output,fmt,args);
   va_end (args);
-  Serial.print(tmp);
   }
 //============================================================================
 uint8_t Validate_and_Print_Chip_ID(uint32_t Chip_ID)
@@ -161,42 +392,122 @@ uint8_t Validate_and_Print_Chip_ID(uint32_t Chip_ID)
   return(return_value);
   }
 //============================================================================
+// Non-zero while CS# is being held low on a write into EVE_RAM_CMD
+uint8_t
+  EVE_Cmd_Open;
+// The EVE_RAM_CMD offset that the next byte of the open write will land on
+uint16_t
+  EVE_Cmd_Offset;
+// Bytes we know are free in the command ring, from the last read of
+// EVE_REG_CMD_READ (or EVE_REG_CMDB_SPACE) minus what has been written
+// since. The EVE is only asked again once this runs out.
+static uint16_t
+  EVE_Cmd_Space;
+// Non-zero once a command writer has given up waiting for room.
+uint8_t
+  EVE_Cmd_Stalled;
+//============================================================================
+#if (0 != EVE_CMD_DRY_RUN)
+uint8_t
+  EVE_Cmd_Dry_Running;
+uint16_t
+  EVE_Cmd_Dry_Run_Bytes;
+static uint32_t
+  EVE_Cmd_Dry_Run_CRC;
+// CRC-32 (the zip/Ethernet one) a nibble at a time, from a 64-byte table
+static const uint32_t EVE_CRC32_Table[16] PROGMEM =
+  {
+  0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL,
+  0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+  0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL,
+  0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+  };
+//----------------------------------------------------------------------------
+static void _EVE_Cmd_Dry_Run_8(uint8_t data)
+  {
+  uint32_t
+    crc;
+  crc=EVE_Cmd_Dry_Run_CRC;
+  crc=pgm_read_dword(&EVE_CRC32_Table[(crc^data)&0x0F])^(crc>>4);
+  crc=pgm_read_dword(&EVE_CRC32_Table[(crc^(data>>4))&0x0F])^(crc>>4);
+  EVE_Cmd_Dry_Run_CRC=crc;
+  EVE_Cmd_Dry_Run_Bytes++;
+  }
+//----------------------------------------------------------------------------
+void EVE_Cmd_Dry_Run_Start(void)
+  {
+  //Anything still open belongs to the last real pass.
+  EVE_Cmd_Burst_Close();
+  EVE_Cmd_Dry_Run_CRC=0xFFFFFFFFUL;
+  EVE_Cmd_Dry_Run_Bytes=0;
+  EVE_Cmd_Dry_Running=1;
+  }
+//----------------------------------------------------------------------------
+uint32_t EVE_Cmd_Dry_Run_End(void)
+  {
+  EVE_Cmd_Dry_Running=0;
+  return(~EVE_Cmd_Dry_Run_CRC);
+  }
+#endif // (0 != EVE_CMD_DRY_RUN)
+//============================================================================
+// If a coprocessor command burst is open, end it so something else can use
+// the SPI bus. It is safe to call this at any time.
+void EVE_Cmd_Burst_Close(void)
+  {
+  if(0 != EVE_Cmd_Open)
+    {
+    //De-select the EVE
+    EVE_SPI_Deselect();
+    EVE_Cmd_Open=0;
+    }
+  }
+//============================================================================
 void _EVE_Select_and_Address(uint32_t Address, uint8_t Operation)
   {
-  //Select the EVE
-  CLR_EVE_CS_NOT;
-  // Send Operation plus high address byte
-  SPI.transfer((uint8_t)(Address >> 16) | Operation);
-  // Send middle address byte
-  SPI.transfer((uint8_t)(Address >> 8));
-  // Send low address byte
-  SPI.transfer((uint8_t)(Address));
+  //Any open command burst has to be finished before we can start a
+  //transaction at a different address.
+  EVE_Cmd_Burst_Close();
+  uint8_t
+    header[3];
+  // Operation plus high address byte
+  header[0]=(uint8_t)(Address >> 16) | Operation;
+  // Middle address byte
+  header[1]=(uint8_t)(Address >> 8);
+  // Low address byte
+  header[2]=(uint8_t)(Address);
+  //Select the EVE and send all three in one go
+  EVE_SPI_Select();
+  EVE_SPI_Write_Burst(header,3);
   }
 //============================================================================
 void EVE_Command_Write(uint8_t Command, uint8_t Parameter)
   {
+  EVE_Cmd_Burst_Close();
   //Select the EVE
-  CLR_EVE_CS_NOT;
+  EVE_SPI_Select();
   // Send 1st (command) byte
-  SPI.transfer(Command);
+  EVE_SPI_Write_8(Command);
   // Send 2nd (parameter) byte
-  SPI.transfer(Parameter);
+  EVE_SPI_Write_8(Parameter);
   // Send 3rd (always 0)byte
-  SPI.transfer(0);
+  EVE_SPI_Write_8(0);
   //End the transaction.
-  SET_EVE_CS_NOT;  
+  EVE_SPI_Deselect();
   }
 //============================================================================
 void _EVE_send_32(uint32_t Data)
   {
-  // Send data low byte
-  SPI.transfer((uint8_t)(Data));
-  // Send data mid-low byte
-  SPI.transfer((uint8_t)(Data >> 8));
-  // Send data mid-high byte
-  SPI.transfer((uint8_t)(Data >> 16));
-  // Send data high byte
-  SPI.transfer((uint8_t)(Data >> 24));
+  uint8_t
+    bytes[4];
+  // Data low byte
+  bytes[0]=(uint8_t)(Data);
+  // Data mid-low byte
+  bytes[1]=(uint8_t)(Data >> 8);
+  // Data mid-high byte
+  bytes[2]=(uint8_t)(Data >> 16);
+  // Data high byte
+  bytes[3]=(uint8_t)(Data >> 24);
+  EVE_SPI_Write_Burst(bytes,4);
   }
 //============================================================================
 void EVE_REG_Write_8(uint32_t REG_Address, uint8_t ftData8)
@@ -204,21 +515,24 @@ void EVE_REG_Write_8(uint32_t REG_Address, uint8_t ftData8)
   //Select the EVE and send the 24-bit address and operation flag.
   _EVE_Select_and_Address(REG_Address, EVE_MEM_WRITE);
   // Send data byte
-  SPI.transfer(ftData8);
+  EVE_SPI_Write_8(ftData8);
   //De-select the EVE
-  SET_EVE_CS_NOT;
+  EVE_SPI_Deselect();
   }
 //============================================================================
 void EVE_REG_Write_16(uint32_t REG_Address, uint16_t ftData16)
   {
+  uint8_t
+    bytes[2];
+  // Data low byte
+  bytes[0]=(uint8_t)(ftData16);
+  // Data high byte
+  bytes[1]=(uint8_t)(ftData16 >> 8);
   //Select the EVE and send the 24-bit address and operation flag.
   _EVE_Select_and_Address(REG_Address, EVE_MEM_WRITE);
-  // Send data low byte
-  SPI.transfer((uint8_t)(ftData16));
-  // Send data high byte
-  SPI.transfer((uint8_t)(ftData16 >> 8));
+  EVE_SPI_Write_Burst(bytes,2);
   //De-select the EVE
-  SET_EVE_CS_NOT;
+  EVE_SPI_Deselect();
   }
 //============================================================================
 void EVE_REG_Write_32(uint32_t REG_Address, uint32_t ftData32)
@@ -228,55 +542,358 @@ void EVE_REG_Write_32(uint32_t REG_Address, uint32_t ftData32)
   //Send the uint32_t ftData32
   _EVE_send_32(ftData32);
   //De-select the EVE
-  SET_EVE_CS_NOT;
+  EVE_SPI_Deselect();
   }
+//============================================================================
+// These four are the building blocks for writing into the EVE_RAM_CMD
+// circular buffer:
+//
+//   _EVE_Cmd_Start(FWol)          select the EVE at EVE_RAM_CMD+FWol, or
+//                                 keep going if a write is already open
+//                                 at exactly that offset.
+//   FWol=_EVE_Cmd_send_32(FWol,d) send a uint32_t, advance FWol
+//   FWol=_EVE_Cmd_send_8(FWol,d)  send a byte, advance FWol
+//   _EVE_Cmd_End()                de-select the EVE, or with EVE_CMD_BURST
+//                                 leave the transaction open so that the
+//                                 next command can simply be appended.
+//
+// When FWol wraps from 0xFFF back to 0x000 the transaction is ended, and
+// the next byte sent re-opens it at the bottom of EVE_RAM_CMD.
+//
+// Every word sent is first reserved against EVE_Cmd_Space, so the ring
+// can not be overrun. When it fills up the coprocessor is started on
+// what is already there, and we wait for it to make room. So a display
+// list or upload bigger than the 4K ring just works, there is no need to
+// check Get_Free_CMD_Space() first.
+//
+// With EVE_CMD_CMDB the bytes go to EVE_REG_CMDB_WRITE instead. The EVE
+// then places them in EVE_RAM_CMD and advances EVE_REG_CMD_WRITE itself,
+// so there is no wrap to worry about and EVE_Cmd_Flush() has nothing to
+// write. FWol is still advanced exactly the same way, so it keeps
+// matching EVE_REG_CMD_WRITE for the waits and for raw writes into
+// EVE_RAM_CMD.
 //----------------------------------------------------------------------------
-uint16_t EVE_Cmd_Dat_0(uint16_t FWol,
-                       uint32_t command)
+// Shortest and longest pause between reads of a register being waited on,
+// in uS. Reading it in a tight loop only keeps the SPI bus (which the uSD
+// shares) busy without getting the answer any sooner.
+#define EVE_POLL_MIN_US        (8)
+#define EVE_POLL_MAX_US        (1024)
+// How long a command writer waits for the coprocessor to make room in
+// the ring before it decides the coprocessor is stuck.
+#define EVE_CMD_SPACE_TIMEOUT_MS (1000)
+//----------------------------------------------------------------------------
+// Ask the EVE how much room there is in the command ring.
+static void _EVE_Cmd_Refresh_Space(uint16_t FWol)
+  {
+  uint16_t
+    read_address;
+  read_address=EVE_REG_Read_16(EVE_REG_CMD_READ);
+  if(0xFFF == read_address)
+    {
+    //Coprocessor fault, it is not going to make any room. Let the writes
+    //go, the next wait will see the fault and reset it.
+    EVE_Cmd_Space=4096-4;
+    return;
+    }
+#if (0 != EVE_CMD_CMDB)
+  (void)FWol;
+  EVE_Cmd_Space=EVE_REG_Read_16(EVE_REG_CMDB_SPACE)&0xFFF;
+#else
+  // (4K - 4) - (write-read)
+  EVE_Cmd_Space=(4096-4)-((FWol-read_address)&0x0FFF);
+#endif // (0 != EVE_CMD_CMDB)
+  }
+//----------------------------------------------------------------------------
+// Make sure there are at least bytes free in the command ring, waiting
+// for the coprocessor to make room if need be. Talking to the EVE ends
+// any open burst, so this is only called on a 4 byte boundary.
+//
+// If the coprocessor stops reading without faulting, this gives up after
+// EVE_CMD_SPACE_TIMEOUT_MS and sets EVE_Cmd_Stalled. The writes then go
+// through without waiting (the ring is lost anyway), and the next wait
+// reports EVE_COPRO_TIMEOUT so the caller can reset the coprocessor.
+static void _EVE_Cmd_Reserve(uint16_t FWol, uint16_t bytes)
   {
-  //Combine Address_offset into  then select the EVE
+  uint32_t
+    start_ms;
+  uint16_t
+    pause_us;
+  if(EVE_Cmd_Space < bytes)
+    {
+#if (0 == EVE_CMD_CMDB)
+    //Full as far as we know. Get the coprocessor working on what is
+    //already queued so that it can make room.
+    EVE_Cmd_Flush(FWol);
+#endif // (0 == EVE_CMD_CMDB)
+    _EVE_Cmd_Refresh_Space(FWol);
+    start_ms=millis();
+    pause_us=EVE_POLL_MIN_US;
+    while(EVE_Cmd_Space < bytes)
+      {
+      if((0 != EVE_Cmd_Stalled)||
+         (EVE_CMD_SPACE_TIMEOUT_MS <= (millis()-start_ms)))
+        {
+        if(0 == EVE_Cmd_Stalled)
+          {
+          DBG_STAT("_EVE_Cmd_Reserve(): no room in the ring after %u ms.\n",
+                   EVE_CMD_SPACE_TIMEOUT_MS);
+          EVE_Cmd_Stalled=1;
+          }
+        EVE_Cmd_Space=4096-4;
+        break;
+        }
+      //Not there yet, give it a while longer than last time.
+      delayMicroseconds(pause_us);
+      if(pause_us < EVE_POLL_MAX_US)
+        {
+        pause_us<<=1;
+        }
+      _EVE_Cmd_Refresh_Space(FWol);
+      }
+    }
+  EVE_Cmd_Space-=bytes;
+  }
+//----------------------------------------------------------------------------
+void _EVE_Cmd_Start(uint16_t FWol)
+  {
+#if (0 != EVE_CMD_DRY_RUN)
+  if(0 != EVE_Cmd_Dry_Running)
+    {
+    return;
+    }
+#endif // (0 != EVE_CMD_DRY_RUN)
+  if((0 != EVE_Cmd_Open)&&(FWol == EVE_Cmd_Offset))
+    {
+    //Still selected and pointing at the right place, just keep sending.
+    return;
+    }
+#if (0 != EVE_CMD_CMDB)
+  //Select the EVE at the command FIFO register.
+  _EVE_Select_and_Address(EVE_REG_CMDB_WRITE,EVE_MEM_WRITE);
+#else
+  //Combine Address_offset into then select the EVE
   //and send the 24-bit address and operation flag.
   _EVE_Select_and_Address(EVE_RAM_CMD|FWol,EVE_MEM_WRITE);
+#endif // (0 != EVE_CMD_CMDB)
+  EVE_Cmd_Open=1;
+  EVE_Cmd_Offset=FWol;
+  }
+//----------------------------------------------------------------------------
+uint16_t _EVE_Cmd_send_32(uint16_t FWol, uint32_t Data)
+  {
+#if (0 != EVE_CMD_DRY_RUN)
+  if(0 != EVE_Cmd_Dry_Running)
+    {
+    //Little-endian, the order the bytes would go out in.
+    _EVE_Cmd_Dry_Run_8((uint8_t)Data);
+    _EVE_Cmd_Dry_Run_8((uint8_t)(Data>>8));
+    _EVE_Cmd_Dry_Run_8((uint8_t)(Data>>16));
+    _EVE_Cmd_Dry_Run_8((uint8_t)(Data>>24));
+    return((FWol+4)&0xFFF);
+    }
+#endif // (0 != EVE_CMD_DRY_RUN)
+  //Make sure there is room
+  _EVE_Cmd_Reserve(FWol,4);
+  //Re-open after a wrap
+  _EVE_Cmd_Start(FWol);
   //Send the uint32_t data
-  _EVE_send_32(command);
+  _EVE_send_32(Data);
+  //Increment address offset modulo 4096
+  FWol=(FWol+4)&0xFFF;
+  EVE_Cmd_Offset=FWol;
+#if (0 == EVE_CMD_CMDB)
+  if(0 == FWol)
+    {
+    //Wrapped, the next byte goes to the bottom of EVE_RAM_CMD.
+    EVE_Cmd_Burst_Close();
+    }
+#endif // (0 == EVE_CMD_CMDB)
+  return(FWol);
+  }
+//----------------------------------------------------------------------------
+uint16_t _EVE_Cmd_send_8(uint16_t FWol, uint8_t Data)
+  {
+#if (0 != EVE_CMD_DRY_RUN)
+  if(0 != EVE_Cmd_Dry_Running)
+    {
+    _EVE_Cmd_Dry_Run_8(Data);
+    return((FWol+1)&0xFFF);
+    }
+#endif // (0 != EVE_CMD_DRY_RUN)
+  if(0 == (FWol&0x03))
+    {
+    //Make sure there is room for this whole word.
+    _EVE_Cmd_Reserve(FWol,4);
+    }
+  //Re-open after a wrap
+  _EVE_Cmd_Start(FWol);
+  EVE_SPI_Write_8(Data);
+  //Increment address offset modulo 4096
+  FWol=(FWol+1)&0xFFF;
+  EVE_Cmd_Offset=FWol;
+#if (0 == EVE_CMD_CMDB)
+  if(0 == FWol)
+    {
+    //Wrapped, the next byte goes to the bottom of EVE_RAM_CMD.
+    EVE_Cmd_Burst_Close();
+    }
+#endif // (0 == EVE_CMD_CMDB)
+  return(FWol);
+  }
+//----------------------------------------------------------------------------
+void _EVE_Cmd_End(void)
+  {
+#if (0 == EVE_CMD_BURST)
   //De-select the EVE
-  SET_EVE_CS_NOT;
-  //Increment address offset modulo 4096 and return it
-  return((FWol+4)&0xFFF);
+  EVE_Cmd_Burst_Close();
+#endif // (0 == EVE_CMD_BURST)
+  //Otherwise leave the EVE selected. _EVE_Cmd_Start() will pick up from
+  //here if the next command lands where this one ended.
+  }
+//----------------------------------------------------------------------------
+// Get the coprocessor going on everything queued up to FWol.
+void EVE_Cmd_Flush(uint16_t FWol)
+  {
+#if (0 != EVE_CMD_DRY_RUN)
+  if(0 != EVE_Cmd_Dry_Running)
+    {
+    return;
+    }
+#endif // (0 != EVE_CMD_DRY_RUN)
+#if (0 != EVE_CMD_CMDB)
+  //The EVE already has it all, just finish the write.
+  (void)FWol;
+  EVE_Cmd_Burst_Close();
+#else
+  // Update the ring buffer pointer so the graphics processor starts executing
+  EVE_REG_Write_16(EVE_REG_CMD_WRITE,FWol);
+#endif // (0 != EVE_CMD_CMDB)
+  }
+//----------------------------------------------------------------------------
+// Pipe a block of data into the command ring, typically the payload of a
+// CMD_INFLATE or CMD_LOADIMAGE. The length must be a multiple of 4. The
+// data goes out in as few bursts as the free space and the wrap allow,
+// and the coprocessor is kicked whenever the ring fills up. Call
+// EVE_Cmd_Flush() (or wait) afterwards to get it executing the rest.
+static uint16_t _EVE_Cmd_Stream(uint16_t FWol,
+                                const uint8_t *data,
+                                uint32_t length,
+                                uint8_t from_flash)
+  {
+#if (0 != EVE_CMD_DRY_RUN)
+  if(0 != EVE_Cmd_Dry_Running)
+    {
+    FWol=(FWol+length)&0xFFF;
+    while(0 != length)
+      {
+      _EVE_Cmd_Dry_Run_8(from_flash?pgm_read_byte(data):*data);
+      data++;
+      length--;
+      }
+    return(FWol);
+    }
+#endif // (0 != EVE_CMD_DRY_RUN)
+  while(0 != length)
+    {
+    uint16_t
+      bytes_this_block;
+    //Wait for at least one word of room.
+    _EVE_Cmd_Reserve(FWol,4);
+    //Take that word, and as much more as there is room for.
+    bytes_this_block=EVE_Cmd_Space+4;
+    if(length < bytes_this_block)
+      {
+      bytes_this_block=(uint16_t)length;
+      }
+#if (0 == EVE_CMD_CMDB)
+    //Do not run off the top of EVE_RAM_CMD.
+    if((uint16_t)(4096-FWol) < bytes_this_block)
+      {
+      bytes_this_block=4096-FWol;
+      }
+#endif // (0 == EVE_CMD_CMDB)
+    EVE_Cmd_Space-=bytes_this_block-4;
+    //Select the EVE at the current offset (or continue the burst)
+    _EVE_Cmd_Start(FWol);
+    if(0 != from_flash)
+      {
+      EVE_SPI_Write_Burst_P(data,bytes_this_block);
+      }
+    else
+      {
+      EVE_SPI_Write_Burst(data,bytes_this_block);
+      }
+    data+=bytes_this_block;
+    length-=bytes_this_block;
+    //Increment address offset modulo 4096
+    FWol=(FWol+bytes_this_block)&0xFFF;
+    EVE_Cmd_Offset=FWol;
+#if (0 == EVE_CMD_CMDB)
+    if(0 == FWol)
+      {
+      //Wrapped, the next byte goes to the bottom of EVE_RAM_CMD.
+      EVE_Cmd_Burst_Close();
+      }
+#endif // (0 == EVE_CMD_CMDB)
+    }
+  //De-select the EVE (or leave the burst open)
+  _EVE_Cmd_End();
+  return(FWol);
+  }
+//----------------------------------------------------------------------------
+uint16_t EVE_Cmd_Stream(uint16_t FWol, const uint8_t *data, uint32_t length)
+  {
+  return(_EVE_Cmd_Stream(FWol,data,length,0));
+  }
+//----------------------------------------------------------------------------
+uint16_t EVE_Cmd_Stream_P(uint16_t FWol, const uint8_t *flash_data, uint32_t length)
+  {
+  return(_EVE_Cmd_Stream(FWol,flash_data,length,1));
+  }
+//----------------------------------------------------------------------------
+uint16_t EVE_Cmd_Dat_0(uint16_t FWol,
+                       uint32_t command)
+  {
+  //Select the EVE at the current offset (or continue the burst)
+  _EVE_Cmd_Start(FWol);
+  //Send the uint32_t data
+  FWol=_EVE_Cmd_send_32(FWol,command);
+  //De-select the EVE (or leave the burst open)
+  _EVE_Cmd_End();
+  //Return the address offset, incremented modulo 4096
+  return(FWol);
   }
 //----------------------------------------------------------------------------
 uint16_t EVE_Cmd_Dat_1(uint16_t FWol,
                        uint32_t command,uint32_t data0)
   {
-  //Combine Address_offset into  then select the EVE
-  //and send the 24-bit address and operation flag.
-  _EVE_Select_and_Address(EVE_RAM_CMD|FWol,EVE_MEM_WRITE);
+  //Select the EVE at the current offset (or continue the burst)
+  _EVE_Cmd_Start(FWol);
   //Send the uint32_t data
-  _EVE_send_32(command);
+  FWol=_EVE_Cmd_send_32(FWol,command);
   //Send the first uint32_t data
-  _EVE_send_32(data0);
-  //De-select the EVE
-  SET_EVE_CS_NOT;
-  //Increment address offset modulo 4096 and return it
-  return((FWol+8)&0xFFF);
+  FWol=_EVE_Cmd_send_32(FWol,data0);
+  //De-select the EVE (or leave the burst open)
+  _EVE_Cmd_End();
+  //Return the address offset, incremented modulo 4096
+  return(FWol);
   }
 //----------------------------------------------------------------------------
 uint16_t EVE_Cmd_Dat_2(uint16_t FWol,
                        uint32_t command,uint32_t data0, uint32_t data1)
   {
-  //Combine Address_offset into  then select the EVE
-  //and send the 24-bit address and operation flag.
-  _EVE_Select_and_Address(EVE_RAM_CMD|FWol,EVE_MEM_WRITE);
+  //Select the EVE at the current offset (or continue the burst)
+  _EVE_Cmd_Start(FWol);
   //Send the uint32_t data
-  _EVE_send_32(command);
+  FWol=_EVE_Cmd_send_32(FWol,command);
   //Send the first uint32_t data
-  _EVE_send_32(data0);
+  FWol=_EVE_Cmd_send_32(FWol,data0);
   //Send the second uint32_t data
-  _EVE_send_32(data1);
-  //De-select the EVE
-  SET_EVE_CS_NOT;
-  //Increment address offset modulo 4096 and return it
-  return((FWol+12)&0xFFF);
+  FWol=_EVE_Cmd_send_32(FWol,data1);
+  //De-select the EVE (or leave the burst open)
+  _EVE_Cmd_End();
+  //Return the address offset, incremented modulo 4096
+  return(FWol);
   }
 //----------------------------------------------------------------------------
 uint16_t EVE_Cmd_Dat_3(uint16_t FWol,
@@ -285,21 +902,20 @@ uint16_t EVE_Cmd_Dat_3(uint16_t FWol,
                        uint32_t data1,
                        uint32_t data2)
   {
-  //Combine Address_offset into  then select the EVE
-  //and send the 24-bit address and operation flag.
-  _EVE_Select_and_Address(EVE_RAM_CMD|FWol,EVE_MEM_WRITE);
+  //Select the EVE at the current offset (or continue the burst)
+  _EVE_Cmd_Start(FWol);
   //Send the uint32_t data
-  _EVE_send_32(command);
+  FWol=_EVE_Cmd_send_32(FWol,command);
   //Send the first uint32_t data
-  _EVE_send_32(data0);
+  FWol=_EVE_Cmd_send_32(FWol,data0);
   //Send the second uint32_t data
-  _EVE_send_32(data1);
+  FWol=_EVE_Cmd_send_32(FWol,data1);
   //Send the third uint32_t data
-  _EVE_send_32(data2);
-  //De-select the EVE
-  SET_EVE_CS_NOT;
-  //Increment address offset modulo 4096 and return it
-  return((FWol+16)&0xFFF);
+  FWol=_EVE_Cmd_send_32(FWol,data2);
+  //De-select the EVE (or leave the burst open)
+  _EVE_Cmd_End();
+  //Return the address offset, incremented modulo 4096
+  return(FWol);
   }
 //============================================================================
 uint8_t EVE_REG_Read_8(uint32_t REG_Address)
@@ -309,53 +925,59 @@ uint8_t EVE_REG_Read_8(uint32_t REG_Address)
   //Select the EVE and send the 24-bit address and operation flag.
   _EVE_Select_and_Address(REG_Address, EVE_MEM_READ);
   // Send dummy byte
-  SPI.transfer(0);
+  EVE_SPI_Write_8(0);
   // Send another dummy, but this time the EVE will reply with the goods.
-  ftData8 = SPI.transfer(0);
+  EVE_SPI_Read_Burst(&ftData8,1);
   //De-select the EVE
-  SET_EVE_CS_NOT;
+  EVE_SPI_Deselect();
   // Return uint8_t read
   return(ftData8);
   }
 //============================================================================
 uint16_t EVE_REG_Read_16(uint32_t REG_Address)
   {
+  uint8_t
+    ftData[2];
   uint16_t
     ftData16;
   //Select the EVE and send the 24-bit address and operation flag.
   _EVE_Select_and_Address(REG_Address, EVE_MEM_READ);
   // Send dummy byte
-  SPI.transfer(0);
+  EVE_SPI_Write_8(0);
   // Send more dummies, but now the EVE will reply with the goods.
-  // Read low byte
-  ftData16 = SPI.transfer(0);
-  // Read high byte
-  ftData16 |= (uint16_t)SPI.transfer(0) << 8;
+  EVE_SPI_Read_Burst(ftData,2);
+  // Low byte
+  ftData16 = ftData[0];
+  // High byte
+  ftData16 |= (uint16_t)ftData[1] << 8;
   //De-select the EVE
-  SET_EVE_CS_NOT;
+  EVE_SPI_Deselect();
   // Return uint16_t read
   return(ftData16);
   }
 //============================================================================
 uint32_t EVE_REG_Read_32(uint32_t REG_Address)
   {
+  uint8_t
+    ftData[4];
   uint32_t
     ftData32;
   //Select the EVE and send the 24-bit address and operation flag.
   _EVE_Select_and_Address(REG_Address, EVE_MEM_READ);
   // Send dummy byte
-  SPI.transfer(0);
+  EVE_SPI_Write_8(0);
   // Send more dummies, but now the EVE will reply with the goods.
-  // Read low byte
-  ftData32 = (uint32_t)SPI.transfer(0);
-  // Read mid-low byte
-  ftData32 |= (uint32_t)SPI.transfer(0) << 8;
-  // Read mid-high byte
-  ftData32 |= (uint32_t)SPI.transfer(0) << 16;
-  // Read high byte
-  ftData32 |= (uint32_t)SPI.transfer(0) << 24;
+  EVE_SPI_Read_Burst(ftData,4);
+  // Low byte
+  ftData32 = (uint32_t)ftData[0];
+  // Mid-low byte
+  ftData32 |= (uint32_t)ftData[1] << 8;
+  // Mid-high byte
+  ftData32 |= (uint32_t)ftData[2] << 16;
+  // High byte
+  ftData32 |= (uint32_t)ftData[3] << 24;
   //De-select the EVE
-  SET_EVE_CS_NOT;
+  EVE_SPI_Deselect();
   // Return uint32_t read
   return(ftData32);
   }
@@ -365,15 +987,11 @@ void EVE_Read_Array(uint32_t EVE_Address, uint16_t length, uint8_t *destination)
   //Select the EVE and send the 24-bit address and operation flag.
   _EVE_Select_and_Address(EVE_Address, EVE_MEM_READ);
   // Send dummy byte
-  SPI.transfer(0);
-  while(0 != length)
-    {
-    *destination=SPI.transfer(0);
-    destination++;
-    length--;
-    }
+  EVE_SPI_Write_8(0);
+  // Clock the whole block in.
+  EVE_SPI_Read_Burst(destination,length);
   //De-select the EVE
-  SET_EVE_CS_NOT;
+  EVE_SPI_Deselect();
   }
 //============================================================================
 // ref: BRT_AN_033_BT81X_Series_Programming_Guide, page 101
@@ -381,9 +999,12 @@ void EVE_Read_Array(uint32_t EVE_Address, uint16_t length, uint8_t *destination)
 // ref: EVE Series Programmer Guide, page 157
 //      http://www.ftdichip.com/Support/Documents/ProgramGuides/EVE_Series_Programmer_Guide.pdf
 // ref: https://github.com/RudolphRiedel/FT800-FT813/blob/4.x/EVE_commands.c
+uint16_t
+  EVE_Copro_Resets;
 #if (0 != ROBUST_EXECUTION_COMPLETE)
 uint16_t Reset_EVE_Coprocessor(void)
   {
+  EVE_Copro_Resets++;
 #if ((EVE_DEVICE==BT815)||(EVE_DEVICE==BT816)||(EVE_DEVICE==BT817)||(EVE_DEVICE==BT818))
 #if (DEBUG_LEVEL != DEBUG_NONE)
   // If debug is on, and we are a BT81x, read the error string from
@@ -421,6 +1042,9 @@ uint16_t Reset_EVE_Coprocessor(void)
   EVE_REG_Write_8(EVE_REG_PCLK, LCD_PCLK);
   // Keep our local Write Offset varaible in sync
   FWol = 0;
+  // Re-read the free space before the next command
+  EVE_Cmd_Space = 0;
+  EVE_Cmd_Stalled = 0;
   // restart the co-processor engine
   EVE_REG_Write_8(EVE_REG_CPURESET, 0);
   // ! From Bridgetek CoprocessorFault_Recover() example
@@ -448,7 +1072,7 @@ uint16_t Reset_EVE_Coprocessor(void)
   _EVE_Select_and_Address(ftAddress, EVE_MEM_WRITE);
   _EVE_send_32(CMD_FLASHATTACH);
   _EVE_send_32(CMD_FLASHFAST);
-  SET_EVE_CS_NOT;
+  EVE_SPI_Deselect();
   //Increment address offset modulo 4096
   FWol=(FWol+8)&0xFFF;
   // Update the ring buffer pointer so the graphics processor starts executing
@@ -473,62 +1097,155 @@ uint16_t Reset_EVE_Coprocessor(void)
 // It seems to have some negative side effects.
 #define WRITE_AND_READ_SPI_VECTOR (0)
 //
+#if (0 != EVE_USE_INT_PIN)
+// How long to wait for EVE_INT before going back to the SPI anyway, in
+// case an interrupt was missed. A bit more than one frame.
+#define EVE_INT_TIMEOUT_MS (20)
+// Set once EVE_Interrupt_Initialize() has programmed the EVE, until then
+// (during EVE_Initialize()) the waits have to poll.
+static uint8_t
+  EVE_Interrupt_Enabled;
+#if defined(__AVR__)
+// EVE_INT is PD7 = PCINT23. The handler has nothing to do, the interrupt
+// is only there to wake the CPU up from sleep_cpu().
+EMPTY_INTERRUPT(PCINT2_vect);
+#endif // defined(__AVR__)
+//----------------------------------------------------------------------------
+void EVE_Interrupt_Initialize(void)
+  {
+  //Pull EVE_INT low when the coprocessor has executed everything in
+  //EVE_RAM_CMD, or when a display list swap happens.
+  EVE_REG_Write_8(EVE_REG_INT_MASK, EVE_INT_CMDEMPTY|EVE_INT_SWAP);
+  EVE_REG_Write_8(EVE_REG_INT_EN, 1);
+  //Reading the flags clears them, which releases EVE_INT.
+  (void)EVE_REG_Read_8(EVE_REG_INT_FLAGS);
+#if defined(__AVR__)
+  //Idle sleep keeps the SPI, UART and timers running.
+  set_sleep_mode(SLEEP_MODE_IDLE);
+  //Pin change interrupt on PD7, so EVE_INT can wake us up.
+  PCMSK2 |= _BV(PCINT23);
+  PCICR |= _BV(PCIE2);
+#endif // defined(__AVR__)
+  EVE_Interrupt_Enabled=1;
+  }
+//----------------------------------------------------------------------------
+// Doze until the EVE pulls EVE_INT low (or EVE_INT_TIMEOUT_MS passes),
+// then read EVE_REG_INT_FLAGS, which clears them and releases the pin.
+// Returns the EVE_INT_* flags that were set, or 0 on a timeout.
+uint8_t EVE_Wait_for_Interrupt(void)
+  {
+  uint32_t
+    start_ms;
+  start_ms=millis();
+  while(!EVE_INT_ASSERTED)
+    {
+    if(EVE_INT_TIMEOUT_MS <= (millis()-start_ms))
+      {
+      return(0);
+      }
+#if defined(__AVR__)
+    //Sleep until the pin changes or the next millis() tick. Check the pin
+    //again with interrupts off so an edge right before the sleep is not
+    //lost: the instruction after sei() always runs before any pending
+    //interrupt is taken.
+    cli();
+    if(!EVE_INT_ASSERTED)
+      {
+      sleep_enable();
+      sei();
+      sleep_cpu();
+      sleep_disable();
+      }
+    sei();
+#endif // defined(__AVR__)
+    }
+  return(EVE_REG_Read_8(EVE_REG_INT_FLAGS));
+  }
+#endif // (0 != EVE_USE_INT_PIN)
+//----------------------------------------------------------------------------
 #if (0 != ROBUST_EXECUTION_COMPLETE)
-uint16_t Wait_for_EVE_Execution_Complete(uint16_t SW_write_offset)
+// The wait starts with a guess at how long the coprocessor needs for what
+// is queued, then backs off, doubling the pause between reads of
+// EVE_REG_CMD_READ.
+//
+// Very rough coprocessor speed for the first guess, in bytes of command
+// list executed per uS.
+#define EVE_COPRO_BYTES_PER_US (2)
+//----------------------------------------------------------------------------
+uint8_t EVE_Wait_for_Completion(uint16_t SW_write_offset, uint16_t budget_ms)
   {
   uint32_t
-    timeout;
-  timeout=100000;
+    start_ms;
+  uint32_t
+    report_ms;
+  uint16_t
+    read_address;
+  uint16_t
+    pause_us;
 
 #if (0 != WRITE_AND_READ_SPI_VECTOR)
   uint32_t
     vector;
   vector=0x0FAA55F0;
 #endif
-  uint16_t
-    read_address;
+
+  if(0 != EVE_Cmd_Stalled)
+    {
+    //A writer already gave up on it, there is nothing to wait for.
+    DBG_GEEK("Wait_for_EVE_Execution_Complete: the command ring is stalled.\n");
+    return(EVE_COPRO_TIMEOUT);
+    }
+
+  start_ms=millis();
+  report_ms=start_ms;
+
+#if (DEBUG_LEVEL == DEBUG_GEEK)
+  //We keep our own copy of the write pointer, so there is no need to read
+  //EVE_REG_CMD_WRITE in the loop. Check once that the two agree.
   uint16_t
     write_address;
+  write_address=EVE_REG_Read_16(EVE_REG_CMD_WRITE);
+  if((write_address&0xF003)||(SW_write_offset&0xF003)||(write_address!=SW_write_offset))
+    {
+    DBG_GEEK("Write Mismatch / DWORD Alignment: HDW_W=(%5u,0x%04X) SW_W=(%5u,0x%04X)\n",
+             write_address,write_address,
+             SW_write_offset,SW_write_offset);
+    }
+#endif // (DEBUG_LEVEL == DEBUG_GEEK)
 
-  uint16_t
-    reported_read_address;
-  uint16_t
-    reported_write_address;
-  reported_read_address=0;
-  reported_write_address=0;
+  read_address=EVE_REG_Read_16(EVE_REG_CMD_READ);
+  //First guess: how long the bytes still queued will take.
+  pause_us=((SW_write_offset-read_address)&0xFFF)/EVE_COPRO_BYTES_PER_US;
+  if(pause_us < EVE_POLL_MIN_US)
+    {
+    pause_us=EVE_POLL_MIN_US;
+    }
+  if(EVE_POLL_MAX_US < pause_us)
+    {
+    pause_us=EVE_POLL_MAX_US;
+    }
 
-  do
+  while(read_address!=SW_write_offset)
     {
-    read_address=EVE_REG_Read_16(EVE_REG_CMD_READ);
     //Check for a coprocessor fault.
     if(0xFFF == read_address)
       {
-      DBG_GEEK("Coprocessor Fault detected. Resetting coprocessor.\n");
-      //Return the new offset after resetting the coprocessor.
-      return(Reset_EVE_Coprocessor());
+      DBG_GEEK("Coprocessor Fault detected.\n");
+      return(EVE_COPRO_FAULT);
       }
-    write_address=EVE_REG_Read_16(EVE_REG_CMD_WRITE);
-    if((read_address&0xF003)||(write_address&0xF003)||(SW_write_offset&0xF003)||(write_address!=SW_write_offset))
+    //Check the time budget
+    if((0 != budget_ms)&&(budget_ms <= (millis()-start_ms)))
       {
-      if((reported_read_address!=read_address)||(reported_write_address!=write_address))
-        {
-        if(write_address!=SW_write_offset)
-          {
-          DBG_GEEK("Write Mismatch: HDW_R=(%5u,0x%04X) HDW_W=(%5u,0x%04X) != SW_W=(%5u,0x%04X)\n",
-                       read_address,read_address,
-                       write_address,write_address,
-                       SW_write_offset,SW_write_offset);
-          }
-        if((read_address&0xF003)||(write_address&0xF003)||(SW_write_offset&0xF003))
-          {
-          DBG_GEEK("DWORD Alignment: HDW_R=(%5u,0x%04X) HDW_W=(%5u,0x%04X) SW_W=(%5u,0x%04X)\n",
-                       read_address,read_address,
-                       write_address,write_address,
-                       SW_write_offset,SW_write_offset);
-          }
-        reported_read_address=read_address;
-        reported_write_address=write_address;
-        }
+      DBG_GEEK("Wait_for_EVE_Execution_Complete: not complete after %u mS.\n",budget_ms);
+      return(EVE_COPRO_TIMEOUT);
+      }
+    if(1000 <= (millis()-report_ms))
+      {
+      //Waiting without a budget, just let the geeks know.
+      DBG_GEEK("Wait_for_EVE_Execution_Complete: still waiting. HDW_R=(%5u,0x%04X) SW_W=(%5u,0x%04X)\n",
+               read_address,read_address,
+               SW_write_offset,SW_write_offset);
+      report_ms=millis();
       }
 #if (0 != WRITE_AND_READ_SPI_VECTOR)
     //Write and read REG_MACRO_0 to debug SPI
@@ -548,30 +1265,259 @@ uint16_t Wait_for_EVE_Execution_Complete(uint16_t SW_write_offset)
       }
     vector^=0xFFFFFFFF;
 #endif
-    //Check timeout
-    if(0 != timeout)
+#if (0 != EVE_USE_INT_PIN)
+    if(0 != EVE_Interrupt_Enabled)
       {
-      timeout--;
+      //Let the EVE tell us when it has run out of commands. Since the
+      //flags are cleared before CMD_READ is read again, a completion can
+      //not slip by unnoticed.
+      EVE_Wait_for_Interrupt();
       }
     else
+#endif // (0 != EVE_USE_INT_PIN)
       {
-      DBG_GEEK("Wait_for_EVE_Execution_Complete: 100K tries, not complete.\n");
-      DBG_GEEK("  Pointers: HDW_R=(%5u,0x%04X) HDW_W=(%5u,0x%04X) != SW_W=(%5u,0x%04X)\n",
-               read_address,read_address,
-               write_address,write_address,
-               SW_write_offset,SW_write_offset);
-      //Experimental -- breaks touch calibration
-      //  DBG_GEEK("Coprocessor Fault detected. Resetting coprocessor.\n");
-      //  //Return the new offset after resetting the coprocessor.
-      //  return(Reset_EVE_Coprocessor());
-      timeout=100000;
+      //Not there yet, give it a while longer than last time.
+      delayMicroseconds(pause_us);
+      if(pause_us < EVE_POLL_MAX_US)
+        {
+        pause_us<<=1;
+        }
       }
-    }while(read_address!=SW_write_offset);
+    read_address=EVE_REG_Read_16(EVE_REG_CMD_READ);
+    }
+  //The ring is empty, no need to ask before filling it again.
+  EVE_Cmd_Space=4096-4;
+  return(EVE_COPRO_DONE);
+  }
+//----------------------------------------------------------------------------
+uint16_t Wait_for_EVE_Execution_Complete(uint16_t SW_write_offset)
+  {
+  //No time limit here: some commands (like CMD_CALIBRATE) legitimately
+  //wait for the user. Use EVE_Wait_for_Completion() with a budget where
+  //a hang should be caught. Without one it only times out when a
+  //command writer has already given up (EVE_Cmd_Stalled).
+  if(EVE_COPRO_DONE != EVE_Wait_for_Completion(SW_write_offset,0))
+    {
+    DBG_GEEK("Resetting coprocessor.\n");
+    //Return the new offset after resetting the coprocessor.
+    return(Reset_EVE_Coprocessor());
+    }
   //No error -- return the unmodified offset.
   return(SW_write_offset);
   }
 #endif
 //============================================================================
+// The state of the non-blocking wait. There is only one coprocessor, so
+// there is only one of these.
+static uint16_t
+  EVE_Copro_Write_Offset;
+static uint32_t
+  EVE_Copro_Start_ms;
+static uint16_t
+  EVE_Copro_Budget_ms;
+static uint8_t
+  EVE_Copro_Status=EVE_COPRO_DONE;
+// Non-zero when EVE_REG_CMD_READ has to be read on the next poll. With
+// EVE_INT in use that is only after the pin says something happened.
+static uint8_t
+  EVE_Copro_Check;
+//----------------------------------------------------------------------------
+void EVE_Copro_Start(uint16_t FWol, uint16_t budget_ms)
+  {
+  EVE_Copro_Write_Offset=FWol;
+  EVE_Copro_Budget_ms=budget_ms;
+  EVE_Copro_Start_ms=millis();
+  EVE_Copro_Status=EVE_COPRO_BUSY;
+  EVE_Copro_Check=1;
+  }
+//----------------------------------------------------------------------------
+uint8_t EVE_Copro_Poll(void)
+  {
+  uint16_t
+    read_address;
+  if(EVE_COPRO_BUSY != EVE_Copro_Status)
+    {
+    //Already finished one way or another.
+    return(EVE_Copro_Status);
+    }
+  if(0 != EVE_Cmd_Stalled)
+    {
+    DBG_GEEK("EVE_Copro_Poll: the command ring is stalled.\n");
+    EVE_Copro_Status=EVE_COPRO_TIMEOUT;
+    return(EVE_Copro_Status);
+    }
+#if (0 != EVE_USE_INT_PIN)
+  if(0 != EVE_Interrupt_Enabled)
+    {
+    if(EVE_INT_ASSERTED)
+      {
+      //Clear the flags, then look at CMD_READ. Anything that finishes
+      //after the clear will pull EVE_INT down again.
+      (void)EVE_REG_Read_8(EVE_REG_INT_FLAGS);
+      EVE_Copro_Check=1;
+      }
+    }
+  else
+    {
+    EVE_Copro_Check=1;
+    }
+#else
+  EVE_Copro_Check=1;
+#endif // (0 != EVE_USE_INT_PIN)
+  if(0 != EVE_Copro_Check)
+    {
+    EVE_Copro_Check=0;
+    read_address=EVE_REG_Read_16(EVE_REG_CMD_READ);
+    if(0xFFF == read_address)
+      {
+      DBG_GEEK("EVE_Copro_Poll: coprocessor fault.\n");
+      EVE_Copro_Status=EVE_COPRO_FAULT;
+      return(EVE_Copro_Status);
+      }
+    if(read_address == EVE_Copro_Write_Offset)
+      {
+      EVE_Copro_Status=EVE_COPRO_DONE;
+      return(EVE_Copro_Status);
+      }
+    }
+  if(EVE_Copro_Budget_ms <= (millis()-EVE_Copro_Start_ms))
+    {
+    DBG_GEEK("EVE_Copro_Poll: not done after %u ms.\n",EVE_Copro_Budget_ms);
+    EVE_Copro_Status=EVE_COPRO_TIMEOUT;
+    }
+  return(EVE_Copro_Status);
+  }
+//----------------------------------------------------------------------------
+uint8_t EVE_Copro_Is_Done(void)
+  {
+  return(EVE_COPRO_BUSY != EVE_Copro_Poll());
+  }
+//============================================================================
+// The frame pacing state. There is only one display, so there is only one
+// of these.
+static uint32_t
+  EVE_Frame_Pace_Frame;
+static uint8_t
+  EVE_Frame_Pace_Divider;
+static uint8_t
+  EVE_Frame_Pace_Max_Ticks;
+uint16_t
+  EVE_Frame_Pace_Dropped;
+uint16_t
+  EVE_Frame_Pace_Lost;
+//----------------------------------------------------------------------------
+void EVE_Frame_Pace_Start(uint8_t divider, uint8_t max_ticks)
+  {
+  EVE_Frame_Pace_Divider=(0 != divider)?divider:1;
+  EVE_Frame_Pace_Max_Ticks=(0 != max_ticks)?max_ticks:1;
+  EVE_Frame_Pace_Dropped=0;
+  EVE_Frame_Pace_Lost=0;
+  EVE_Frame_Pace_Frame=EVE_REG_Read_32(EVE_REG_FRAMES);
+  }
+//----------------------------------------------------------------------------
+// Wait for EVE_REG_FRAMES to get to frame, and return what it is then.
+// If a swap is pending (and EVE_INT is in use), EVE_INT_SWAP wakes us up
+// for the first tick. Ticks after that have no swap to signal them, so
+// they are polled with the same back off as EVE_Wait_for_Completion(),
+// up to max_pause_us between reads.
+static uint32_t _EVE_Wait_for_Frame(uint32_t frame,
+                                    uint16_t max_pause_us,
+                                    uint8_t swap_pending)
+  {
+  uint32_t
+    now;
+  uint16_t
+    pause_us;
+#if (0 != EVE_USE_INT_PIN)
+  uint8_t
+    use_interrupt;
+  use_interrupt=(0 != EVE_Interrupt_Enabled)&&(0 != swap_pending);
+#else
+  (void)swap_pending;
+#endif // (0 != EVE_USE_INT_PIN)
+  pause_us=EVE_POLL_MIN_US;
+  now=EVE_REG_Read_32(EVE_REG_FRAMES);
+  while(0 < (int32_t)(frame-now))
+    {
+#if (0 != EVE_USE_INT_PIN)
+    if(0 != use_interrupt)
+      {
+      EVE_Wait_for_Interrupt();
+      use_interrupt=0;
+      }
+    else
+#endif // (0 != EVE_USE_INT_PIN)
+      {
+      delayMicroseconds(pause_us);
+      if(pause_us < max_pause_us)
+        {
+        pause_us<<=1;
+        }
+      }
+    now=EVE_REG_Read_32(EVE_REG_FRAMES);
+    }
+  return(now);
+  }
+//----------------------------------------------------------------------------
+uint8_t EVE_Frame_Pace_Wait(uint8_t swapped)
+  {
+  uint32_t
+    elapsed;
+  uint32_t
+    ticks;
+  //Without a CMD_SWAP there is no EVE_INT_SWAP coming, so poll instead of
+  //sleeping until the interrupt times out.
+  elapsed=_EVE_Wait_for_Frame(EVE_Frame_Pace_Frame+EVE_Frame_Pace_Divider,
+                              EVE_POLL_MAX_US,
+                              swapped)-EVE_Frame_Pace_Frame;
+  ticks=elapsed;
+  if(1 != EVE_Frame_Pace_Divider)
+    {
+    ticks/=EVE_Frame_Pace_Divider;
+    }
+  //Move on by whole ticks only, so a late frame does not shift the ones
+  //after it off the display's beat.
+  EVE_Frame_Pace_Frame+=ticks*EVE_Frame_Pace_Divider;
+  EVE_Frame_Pace_Dropped+=(uint16_t)(ticks-1);
+  if(EVE_Frame_Pace_Max_Ticks < ticks)
+    {
+    //Too far behind to catch up (a long SD read, a coprocessor reset).
+    EVE_Frame_Pace_Lost+=(uint16_t)(ticks-EVE_Frame_Pace_Max_Ticks);
+    ticks=EVE_Frame_Pace_Max_Ticks;
+    }
+  return((uint8_t)ticks);
+  }
+//----------------------------------------------------------------------------
+#define EVE_FRAME_RATE_FRAMES (4)
+// 64uS out of 4 frames at 60Hz is 0.1%
+#define EVE_FRAME_RATE_POLL_US (64)
+uint32_t EVE_Frame_Rate_mHz(void)
+  {
+  uint32_t
+    frame;
+  uint32_t
+    clocks;
+  //Start right as a frame starts. Nothing is being swapped, so EVE_INT
+  //has nothing to say, and how late each edge is seen is the error in
+  //the answer. Poll no more than EVE_FRAME_RATE_POLL_US apart.
+  frame=_EVE_Wait_for_Frame(EVE_REG_Read_32(EVE_REG_FRAMES)+1,
+                            EVE_FRAME_RATE_POLL_US,
+                            0);
+  clocks=EVE_REG_Read_32(EVE_REG_CLOCK);
+  _EVE_Wait_for_Frame(frame+EVE_FRAME_RATE_FRAMES,
+                      EVE_FRAME_RATE_POLL_US,
+                      0);
+  clocks=EVE_REG_Read_32(EVE_REG_CLOCK)-clocks;
+  //Clocks per frame in hundreds, ~10000 at 60MHz and 60Hz, which keeps
+  //the mHz below inside 32 bits up to 429MHz.
+  clocks/=EVE_FRAME_RATE_FRAMES*100UL;
+  if(0 == clocks)
+    {
+    return(0);
+    }
+  return((EVE_REG_Read_32(EVE_REG_FREQUENCY)*10)/clocks);
+  }
+//============================================================================
 uint16_t Get_Free_CMD_Space(uint16_t FWol)
   {
   // (4K - 4) - (write-read)
@@ -601,8 +1547,8 @@ uint16_t Get_RAM_G_Pointer_After_INFLATE(uint16_t FWol,
   //Tell the chip to get the first free location in RAM_G
   FWol=EVE_Cmd_Dat_1(FWol,
                        EVE_ENC_CMD_GETPTR,0);
-  // Update the ring buffer pointer so the graphics processor starts executing
-  EVE_REG_Write_16(EVE_REG_CMD_WRITE,FWol);
+  // Get the graphics processor executing
+  EVE_Cmd_Flush(FWol);
   //Wait for the chip to catch up.
   FWol=Wait_for_EVE_Execution_Complete(FWol);
 
@@ -613,6 +1559,37 @@ uint16_t Get_RAM_G_Pointer_After_INFLATE(uint16_t FWol,
   return(FWol);
   }
 //============================================================================
+// CMD_MEMCRC: the CRC-32 of a block of RAM_G, worked out by the
+// coprocessor. If the coprocessor faults, what is left in RAM_CMD is not
+// the answer, so *crc is not written.
+uint16_t Get_RAM_G_CRC(uint16_t FWol,
+                       uint32_t address,
+                       uint32_t length,
+                       uint32_t *crc)
+  {
+  uint16_t
+    copro_resets;
+  FWol=EVE_Cmd_Dat_3(FWol,
+                     EVE_ENC_CMD_MEMCRC,
+                     address,
+                     length,
+                     //Result goes here
+                     0);
+  // Get the graphics processor executing
+  EVE_Cmd_Flush(FWol);
+  //Wait for the chip to catch up.
+  copro_resets=EVE_Copro_Resets;
+  FWol=Wait_for_EVE_Execution_Complete(FWol);
+  if(copro_resets != EVE_Copro_Resets)
+    {
+    DBG_STAT("Get_RAM_G_CRC(): MEMCRC faulted.\n");
+    return(FWol);
+    }
+  //The answer is in the last word of the command
+  *crc=EVE_REG_Read_32(EVE_RAM_CMD+((FWol-4) & 0x0FFF));
+  return(FWol);
+  }
+//============================================================================
 uint16_t Get_RAM_G_Properties_After_LOADIMAGE(uint16_t FWol,
                                               uint32_t *RAM_G_First_Available,
                                               uint32_t *Width,
@@ -623,8 +1600,8 @@ uint16_t Get_RAM_G_Properties_After_LOADIMAGE(uint16_t FWol,
   // Tell the chip to get the first free location in RAM_G
   FWol=EVE_Cmd_Dat_3(FWol,
                        EVE_ENC_CMD_GETPROPS,0,0,0);
-  // Update the ring buffer pointer so the graphics processor starts executing
-  EVE_REG_Write_16(EVE_REG_CMD_WRITE,FWol);
+  // Get the graphics processor executing
+  EVE_Cmd_Flush(FWol);
   //Wait for the chip to catch up.
   FWol=Wait_for_EVE_Execution_Complete(FWol);
 
@@ -729,32 +1706,12 @@ uint16_t EVE_Init_Goodix_GT911(uint16_t FWol)
   //Make sure that the chip is caught up.
   FWol=Wait_for_EVE_Execution_Complete(FWol);
 
-  //Combine Address_offset into  then select the EVE
-  //and send the 24-bit address and operation flag.
-  _EVE_Select_and_Address(EVE_RAM_CMD|FWol,EVE_MEM_WRITE);
-
-  //Pipe out data_length of data from data_address.
-  const uint8_t
-    *Flash_Data;
-  uint32_t
-    data_length;
-  Flash_Data=Goodix_GT911_Init_Data;
-  data_length=GOODIX_GT911_INIT_DATA_LENGTH;
-  while(0 != data_length)
-    {
-    SPI.transfer(pgm_read_byte(Flash_Data));
-    Flash_Data++;
-    data_length--;
-    }
-
-  //Remember that we sent GOODIX_GT911_INIT_DATA_LENGTH bytes
-  FWol=(FWol+GOODIX_GT911_INIT_DATA_LENGTH)&0xFFF;
-  //De-select the EVE
-  SET_EVE_CS_NOT;
+  //Pipe out the data straight from flash.
+  FWol=EVE_Cmd_Stream_P(FWol,Goodix_GT911_Init_Data,GOODIX_GT911_INIT_DATA_LENGTH);
 
   //OK, the data is in the EVE_RAM_CMD circular buffer, ask the chip
   //to process it.
-  EVE_REG_Write_16(EVE_REG_CMD_WRITE, FWol);
+  EVE_Cmd_Flush(FWol);
   //Now wait for it to catch up
   FWol=Wait_for_EVE_Execution_Complete(FWol);
 
@@ -884,32 +1841,12 @@ uint16_t EVE_Init_Pen_Up_Bug_Fix(uint16_t FWol)
   //Make sure that the chip is caught up.
   FWol=Wait_for_EVE_Execution_Complete(FWol);
 
-  //Combine Address_offset into  then select the EVE
-  //and send the 24-bit address and operation flag.
-  _EVE_Select_and_Address(EVE_RAM_CMD|FWol,EVE_MEM_WRITE);
-
-  //Pipe out data_length of data from data_address.
-  const uint8_t
-    *Flash_Data;
-  uint32_t
-    data_length;
-  Flash_Data=Pen_Up_Bug_Fix_Init_Data;
-  data_length=PEN_UP_BUG_FIX_INIT_DATA_LENGTH;
-  while(0 != data_length)
-    {
-    SPI.transfer(pgm_read_byte(Flash_Data));
-    Flash_Data++;
-    data_length--;
-    }
-
-  //Remember that we sent GOODIX_GT911_INIT_DATA_LENGTH bytes
-  FWol=(FWol+PEN_UP_BUG_FIX_INIT_DATA_LENGTH)&0xFFF;
-  //De-select the EVE
-  SET_EVE_CS_NOT;
+  //Pipe out the data straight from flash.
+  FWol=EVE_Cmd_Stream_P(FWol,Pen_Up_Bug_Fix_Init_Data,PEN_UP_BUG_FIX_INIT_DATA_LENGTH);
 
   //OK, the data is in the EVE_RAM_CMD circular buffer, ask the chip
   //to process it.
-  EVE_REG_Write_16(EVE_REG_CMD_WRITE, FWol);
+  EVE_Cmd_Flush(FWol);
   //Now wait for it to catch up
   FWol=Wait_for_EVE_Execution_Complete(FWol);
 
@@ -1053,6 +1990,12 @@ void Force_Touch_Matrix(void)
 //============================================================================
 uint8_t EVE_Initialize(void)
   {
+  // Get the SPI transport ready
+  if(0 != EVE_SPI_Begin())
+    {
+    DBG_STAT("Could not open the SPI transport to the EVE.\n");
+    return(1);
+    }
   // Wake up the EVE
   delay(20);          // Wait a few MS before waking the FT800
   CLR_EVE_PD_NOT;     // 1) lower PD#
@@ -1404,6 +2347,10 @@ uint8_t EVE_Initialize(void)
     } while(0 != points_touched_mask);
   DBG_GEEK(" done. Polled %ld times(mS).\n",touch_release_polls);
 #endif //  (EVE_TOUCH_TYPE != EVE_TOUCH_NONE)
+#if (0 != EVE_USE_INT_PIN)
+  //From here on, waits for the coprocessor use EVE_INT.
+  EVE_Interrupt_Initialize();
+#endif // (0 != EVE_USE_INT_PIN)
   //Signal success.
   return(0);
   }
@@ -32,8 +32,50 @@
 //
 //For more information, please refer to <http://unlicense.org/>
 //============================================================================
+// Keep a single RAM_CMD write transaction open while consecutive
+// coprocessor commands are appended, instead of selecting and
+// addressing the EVE again for every EVE_Cmd_Dat_n(). Any other access
+// to the EVE (register read/write, etc) closes the open burst first, so
+// callers do not need to know about it. Set to 0 for the original one
+// transaction per command behavior.
+#define EVE_CMD_BURST (1)
+// On FT81x and BT81x, send coprocessor commands through the
+// EVE_REG_CMDB_WRITE FIFO register, with flow control from
+// EVE_REG_CMDB_SPACE, instead of writing EVE_RAM_CMD and then
+// EVE_REG_CMD_WRITE. Saves the separate EVE_REG_CMD_WRITE write per flush,
+// and cannot overrun the coprocessor.
+#define EVE_CMD_CMDB (0)
+#if ((0 != EVE_CMD_CMDB) && (EVE_DEVICE < FT810))
+#error EVE_CMD_CMDB needs an FT81x or BT81x, the FT80x does not have EVE_REG_CMDB_WRITE.
+#endif // ((0 != EVE_CMD_CMDB) && (EVE_DEVICE < FT810))
+// Dry runs: between EVE_Cmd_Dry_Run_Start() and EVE_Cmd_Dry_Run_End() the
+// coprocessor command functions send nothing at all, they only work out
+// the CRC-32 of what they would have sent. A frame can be built that way
+// first to see if it is the same as the last one, and only be built again
+// for real if it is not. Start the real pass from the FWol the dry run
+// started from. Reads and waits (EVE_DL_Cache recording,
+// Wait_for_EVE_Execution_Complete()) do not belong in a dry run.
+#define EVE_CMD_DRY_RUN (0)
+#if (0 != EVE_CMD_DRY_RUN)
+extern uint8_t
+  EVE_Cmd_Dry_Running;
+// Bytes the last dry run would have sent
+extern uint16_t
+  EVE_Cmd_Dry_Run_Bytes;
+void EVE_Cmd_Dry_Run_Start(void);
+uint32_t EVE_Cmd_Dry_Run_End(void);
+#endif // (0 != EVE_CMD_DRY_RUN)
+//----------------------------------------------------------------------------
 void _EVE_Select_and_Address(uint32_t Address, uint8_t Operation);
 void _EVE_send_32(uint32_t Data);
+void _EVE_Cmd_Start(uint16_t FWol);
+uint16_t _EVE_Cmd_send_32(uint16_t FWol, uint32_t Data);
+uint16_t _EVE_Cmd_send_8(uint16_t FWol, uint8_t Data);
+void _EVE_Cmd_End(void);
+void EVE_Cmd_Burst_Close(void);
+void EVE_Cmd_Flush(uint16_t FWol);
+uint16_t EVE_Cmd_Stream(uint16_t FWol, const uint8_t *data, uint32_t length);
+uint16_t EVE_Cmd_Stream_P(uint16_t FWol, const uint8_t *flash_data, uint32_t length);
 void EVE_REG_Write_8(uint32_t REG_Address, uint8_t ftData8);
 void EVE_REG_Write_16(uint32_t REG_Address, uint16_t ftData16);
 void EVE_REG_Write_32(uint32_t REG_Address, uint32_t ftData32);
@@ -43,19 +85,82 @@ uint16_t EVE_Cmd_Dat_1(uint16_t FWol,
                        uint32_t command,uint32_t data0);
 uint16_t EVE_Cmd_Dat_2(uint16_t FWol,
                        uint32_t command,uint32_t data0, uint32_t data1);
+uint16_t EVE_Cmd_Dat_3(uint16_t FWol,
+                       uint32_t command,
+                       uint32_t data0,
+                       uint32_t data1,
+                       uint32_t data2);
 uint8_t EVE_REG_Read_8(uint32_t REG_Address);
 uint16_t EVE_REG_Read_16(uint32_t REG_Address);
 uint32_t EVE_REG_Read_32(uint32_t REG_Address);
 void EVE_Read_Array(uint32_t EVE_Address, uint16_t length, uint8_t *destination);
+uint16_t Reset_EVE_Coprocessor(void);
+// Counts each Reset_EVE_Coprocessor(). A wait that faults resets the
+// coprocessor without saying so, so compare this before and after to
+// find out whether the commands really ran.
+extern uint16_t EVE_Copro_Resets;
+// Set when a command writer gave up waiting for room in the ring, because
+// the coprocessor stopped reading without faulting. The waits then return
+// EVE_COPRO_TIMEOUT (Wait_for_EVE_Execution_Complete() resets it), and
+// Reset_EVE_Coprocessor() clears it.
+extern uint8_t EVE_Cmd_Stalled;
 #define ROBUST_EXECUTION_COMPLETE (1)
 #if (0 == ROBUST_EXECUTION_COMPLETE)
 #define Wait_for_EVE_Execution_Complete(SW_write_offset) while(EVE_REG_Read_16(EVE_REG_CMD_READ) != SW_write_offset)
 #else
 uint16_t Wait_for_EVE_Execution_Complete(uint16_t SW_write_offset);
+// Returns EVE_COPRO_DONE, EVE_COPRO_FAULT or (only if budget_ms is not 0,
+// or EVE_Cmd_Stalled is set) EVE_COPRO_TIMEOUT. Unlike Wait_for_EVE_Execution_Complete() it does not
+// reset the coprocessor itself, that is up to the caller.
+uint8_t EVE_Wait_for_Completion(uint16_t SW_write_offset, uint16_t budget_ms);
 #endif
+#if (0 != EVE_USE_INT_PIN)
+void EVE_Interrupt_Initialize(void);
+uint8_t EVE_Wait_for_Interrupt(void);
+#endif // (0 != EVE_USE_INT_PIN)
+// Non-blocking alternative to Wait_for_EVE_Execution_Complete():
+//   EVE_Copro_Start(FWol,budget_ms)  after writing EVE_REG_CMD_WRITE
+//   EVE_Copro_Poll()                 whenever convenient, returns one of:
+#define EVE_COPRO_BUSY    (0) // still executing
+#define EVE_COPRO_DONE    (1) // caught up with FWol
+#define EVE_COPRO_FAULT   (2) // faulted, call Reset_EVE_Coprocessor()
+#define EVE_COPRO_TIMEOUT (3) // not done within budget_ms, or EVE_Cmd_Stalled
+//   EVE_Copro_Is_Done()              non-zero once it is no longer busy
+void EVE_Copro_Start(uint16_t FWol, uint16_t budget_ms);
+uint8_t EVE_Copro_Poll(void);
+uint8_t EVE_Copro_Is_Done(void);
+// Frame pacing from EVE_REG_FRAMES, the count of frames the display has
+// shown. One tick is divider frames, so the target rate is the refresh
+// rate (see EVE_Frame_Rate_mHz()) over divider.
+//   EVE_Frame_Pace_Start(divider,max_ticks)  once, before the first wait
+//   EVE_Frame_Pace_Wait(swapped)  once per frame. Waits for the next tick,
+//                          then returns how many went by since the last
+//                          call: 1 if the frame was on time, more if it
+//                          was late, but never more than max_ticks. Pass
+//                          swapped as 0 if the frame sent no CMD_SWAP
+//                          (a skipped frame), so the wait does not count
+//                          on EVE_INT_SWAP.
+// Step the animation once per tick and it keeps the same speed however
+// long the frames take to build.
+void EVE_Frame_Pace_Start(uint8_t divider, uint8_t max_ticks);
+uint8_t EVE_Frame_Pace_Wait(uint8_t swapped);
+// Ticks that went by without a new frame (the display showed the last
+// one again), and ticks over max_ticks, which the animation never got.
+// Clear them whenever convenient.
+extern uint16_t
+  EVE_Frame_Pace_Dropped;
+extern uint16_t
+  EVE_Frame_Pace_Lost;
+// The display refresh rate in mHz, timed with EVE_REG_CLOCK over a few
+// frames. Waits for them, so only call it from setup().
+uint32_t EVE_Frame_Rate_mHz(void);
 uint16_t Get_Free_CMD_Space(uint16_t FWol);
 uint16_t Get_RAM_G_Pointer_After_INFLATE(uint16_t FWol,
                                          uint32_t *RAM_G_First_Available);
+uint16_t Get_RAM_G_CRC(uint16_t FWol,
+                       uint32_t address,
+                       uint32_t length,
+                       uint32_t *crc);
 uint16_t Get_RAM_G_Properties_After_LOADIMAGE(uint16_t FWol,
                                               uint32_t *RAM_G_First_Available,
                                               uint32_t *Width,
@@ -71,6 +176,24 @@ uint8_t quiet_backlight_128(uint8_t portion_of_128);
 uint8_t quiet_backlight_percent(uint8_t percent);
 uint8_t EVE_Initialize(void);
 //============================================================================
+// A small printf() that hands each character to output() as it goes,
+// instead of building the string in a buffer. The format is in flash.
+// Understands %[-][0][width][.precision][l] followed by:
+//   d i     signed decimal
+//   u       unsigned decimal
+//   x X     unsigned hex
+//   k       signed fixed-point decimal: precision digits after the point,
+//           so ("%.2k",1234) is "12.34". At most 9.
+//   c       a character
+//   s       a string in RAM
+//   S       a string in flash, like F() or PSTR() give
+//   %       a %
+// A * for the width or precision takes it from an int argument.
+// l is for int32_t and uint32_t. There is no floating point.
+typedef void (*EVE_Format_Output)(char c);
+void EVE_Format(EVE_Format_Output output,
+                const __FlashStringHelper *fmt,
+                va_list args);
 //Don't call SerPrintFF() directly, use DBG_STAT() or DBG_GEEK() macros.
 void SerPrintFF(const __FlashStringHelper *fmt, ... );
 //============================================================================
@@ -263,7 +263,7 @@
 #define EVE_ENC_STENCIL_OP(sfail,spass)                      ((0xcUL << 24)|(((sfail) & 0x7UL) << 3)|(((spass) & 0x7UL) << 0))
 #define EVE_ENC_TAG_MASK(mask)                               ((0x14UL << 24)|(((mask) & 0x1UL) << 0))
 #define EVE_ENC_TAG(s)                                       ((0x3UL << 24)|((((uint32_t)(s)) & 0xffUL) << 0))
-#define EVE_ENC_VERTEX2F(x,y)                                ((0x1UL << 30)|((((uint32_t)(x)) & 0xffffUL) << 15)|((((uint32_t)(y)) & 0xffffUL) << 0))
+#define EVE_ENC_VERTEX2F(x,y)                                ((0x1UL << 30)|((((uint32_t)(x)) & 0x7fffUL) << 15)|((((uint32_t)(y)) & 0x7fffUL) << 0))
 #define EVE_ENC_VERTEX2II(x,y,handle,cell)                   ((0x2UL << 30)|((((uint32_t)(x)) & 0x1ffUL) << 21)|((((uint32_t)(y)) & 0x1ffUL) << 12)|(((handle) & 0x1fUL) << 7)|(((cell) & 0x7fUL) << 0))
 
 #define EVE_ENC_CMD_APPEND              (0xFFFFFF1EUL) // = 4294967070UL
@@ -586,7 +586,7 @@
 #define EVE_ENC_VERTEX_FORMAT(frac)                          ((0x27UL << 24)|(((frac) & 0x7UL) << 0))
 #define EVE_ENC_VERTEX_TRANSLATE_X(x)                        ((0x2bUL << 24)|((((uint32_t)(x)) & 0x1FFFFUL) << 0))
 #define EVE_ENC_VERTEX_TRANSLATE_Y(y)                        ((0x2cUL << 24)|((((uint32_t)(y)) & 0x1FFFFUL) << 0))
-#define EVE_ENC_VERTEX2F(x,y)                                ((0x1UL << 30)|((((uint32_t)(x)) & 0xffffUL) << 15)|((((uint32_t)(y)) & 0xffffUL) << 0))
+#define EVE_ENC_VERTEX2F(x,y)                                ((0x1UL << 30)|((((uint32_t)(x)) & 0x7fffUL) << 15)|((((uint32_t)(y)) & 0x7fffUL) << 0))
 #define EVE_ENC_VERTEX2II(x,y,handle,cell)                   ((0x2UL << 30)|((((uint32_t)(x)) & 0x1ffUL) << 21)|((((uint32_t)(y)) & 0x1ffUL) << 12)|(((handle) & 0x1fUL) << 7)|(((cell) & 0x7fUL) << 0))
 
 #define EVE_ENC_CMD_APPEND              (0xFFFFFF1EUL) // = 4294967070UL
@@ -46,22 +46,325 @@
 #endif
 
 #include "EVE_defines.h"
+#include "EVE_spi.h"
 #include "EVE_base.h"
+#include "EVE_ram_g.h"
+#include "EVE_math.h"
 #include "EVE_draw.h"
 //===========================================================================
+#if (0 != EVE_DL_STATE_TRACKING)
+uint16_t
+  EVE_DL_Elided;
+// The last command sent for each piece of state, 0 if we do not know. No
+// state command encodes to 0 (that is DISPLAY()).
+static struct
+  {
+  uint32_t color_rgb;
+  uint32_t color_a;
+  uint32_t line_width;
+  uint32_t point_size;
+  uint32_t begin;
+  uint32_t bitmap_handle;
+  // These belong to the current bitmap handle
+  uint32_t bitmap_source;
+  uint32_t bitmap_layout;
+  uint32_t bitmap_size;
+  uint32_t cell;
+  uint32_t transform_a;
+  uint32_t transform_b;
+  uint32_t transform_c;
+  uint32_t transform_d;
+  uint32_t transform_e;
+  uint32_t transform_f;
+#if (FT810 <= EVE_DEVICE)
+  uint32_t vertex_format;
+  uint32_t vertex_translate_x;
+  uint32_t vertex_translate_y;
+#endif // (FT810 <= EVE_DEVICE)
+  } EVE_DL_State;
+// The top byte of each command is its opcode.
+#define EVE_DL_OPCODE(command) ((uint8_t)((command) >> 24))
+#endif // (0 != EVE_DL_STATE_TRACKING)
+//---------------------------------------------------------------------------
+void EVE_DL_State_Forget(void)
+  {
+#if (0 != EVE_DL_STATE_TRACKING)
+  memset(&EVE_DL_State,0,sizeof(EVE_DL_State));
+#endif // (0 != EVE_DL_STATE_TRACKING)
+  }
+//---------------------------------------------------------------------------
+uint16_t EVE_DL_Dat_0(uint16_t FWol,
+                      uint32_t command)
+  {
+#if (0 != EVE_DL_STATE_TRACKING)
+  uint32_t
+    *shadow;
+  switch(EVE_DL_OPCODE(command))
+    {
+    case EVE_DL_OPCODE(EVE_ENC_COLOR_RGB(0,0,0)):
+      shadow=&EVE_DL_State.color_rgb;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_COLOR_A(0)):
+      shadow=&EVE_DL_State.color_a;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_LINE_WIDTH(0)):
+      shadow=&EVE_DL_State.line_width;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_POINT_SIZE(0)):
+      shadow=&EVE_DL_State.point_size;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_BEGIN(0)):
+      shadow=&EVE_DL_State.begin;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_BITMAP_HANDLE(0)):
+      if(command != EVE_DL_State.bitmap_handle)
+        {
+        //Different handle, we know nothing about its setup.
+        EVE_DL_State.bitmap_source=0;
+        EVE_DL_State.bitmap_layout=0;
+        EVE_DL_State.bitmap_size=0;
+        }
+      shadow=&EVE_DL_State.bitmap_handle;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_BITMAP_SOURCE(0)):
+      shadow=&EVE_DL_State.bitmap_source;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_BITMAP_LAYOUT(0,0,0)):
+      shadow=&EVE_DL_State.bitmap_layout;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_BITMAP_SIZE(0,0,0,0,0)):
+      shadow=&EVE_DL_State.bitmap_size;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_CELL(0)):
+      shadow=&EVE_DL_State.cell;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_BITMAP_TRANSFORM_A(0)):
+      shadow=&EVE_DL_State.transform_a;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_BITMAP_TRANSFORM_B(0)):
+      shadow=&EVE_DL_State.transform_b;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_BITMAP_TRANSFORM_C(0)):
+      shadow=&EVE_DL_State.transform_c;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_BITMAP_TRANSFORM_D(0)):
+      shadow=&EVE_DL_State.transform_d;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_BITMAP_TRANSFORM_E(0)):
+      shadow=&EVE_DL_State.transform_e;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_BITMAP_TRANSFORM_F(0)):
+      shadow=&EVE_DL_State.transform_f;
+      break;
+#if (FT810 <= EVE_DEVICE)
+    case EVE_DL_OPCODE(EVE_ENC_VERTEX_FORMAT(0)):
+      shadow=&EVE_DL_State.vertex_format;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_VERTEX_TRANSLATE_X(0)):
+      shadow=&EVE_DL_State.vertex_translate_x;
+      break;
+    case EVE_DL_OPCODE(EVE_ENC_VERTEX_TRANSLATE_Y(0)):
+      shadow=&EVE_DL_State.vertex_translate_y;
+      break;
+#endif // (FT810 <= EVE_DEVICE)
+    case EVE_DL_OPCODE(EVE_ENC_END()):
+      //END is only needed to split one strip from the next.
+      if((EVE_ENC_BEGIN(EVE_BEGIN_BITMAPS) == EVE_DL_State.begin)||
+         (EVE_ENC_BEGIN(EVE_BEGIN_POINTS) == EVE_DL_State.begin)||
+         (EVE_ENC_BEGIN(EVE_BEGIN_LINES) == EVE_DL_State.begin)||
+         (EVE_ENC_BEGIN(EVE_BEGIN_RECTS) == EVE_DL_State.begin))
+        {
+        EVE_DL_Elided++;
+        return(FWol);
+        }
+      EVE_DL_State.begin=0;
+      return(EVE_Cmd_Dat_0(FWol,command));
+    default:
+      if(EVE_ENC_CMD_DLSTART == command)
+        {
+        //A new display list starts with the state at its defaults.
+        EVE_DL_State.color_rgb=EVE_ENC_COLOR_RGB(0xFF,0xFF,0xFF);
+        EVE_DL_State.color_a=EVE_ENC_COLOR_A(0xFF);
+        EVE_DL_State.line_width=EVE_ENC_LINE_WIDTH(16);
+        EVE_DL_State.point_size=EVE_ENC_POINT_SIZE(16);
+        EVE_DL_State.begin=0;
+        EVE_DL_State.bitmap_handle=EVE_ENC_BITMAP_HANDLE(0);
+        EVE_DL_State.bitmap_source=0;
+        EVE_DL_State.bitmap_layout=0;
+        EVE_DL_State.bitmap_size=0;
+        EVE_DL_State.cell=EVE_ENC_CELL(0);
+        EVE_DL_State.transform_a=EVE_ENC_BITMAP_TRANSFORM_A(256);
+        EVE_DL_State.transform_b=EVE_ENC_BITMAP_TRANSFORM_B(0);
+        EVE_DL_State.transform_c=EVE_ENC_BITMAP_TRANSFORM_C(0);
+        EVE_DL_State.transform_d=EVE_ENC_BITMAP_TRANSFORM_D(0);
+        EVE_DL_State.transform_e=EVE_ENC_BITMAP_TRANSFORM_E(256);
+        EVE_DL_State.transform_f=EVE_ENC_BITMAP_TRANSFORM_F(0);
+#if (FT810 <= EVE_DEVICE)
+        EVE_DL_State.vertex_format=EVE_ENC_VERTEX_FORMAT(4);
+        EVE_DL_State.vertex_translate_x=EVE_ENC_VERTEX_TRANSLATE_X(0);
+        EVE_DL_State.vertex_translate_y=EVE_ENC_VERTEX_TRANSLATE_Y(0);
+#endif // (FT810 <= EVE_DEVICE)
+        }
+      //Not state we keep track of, just send it.
+      return(EVE_Cmd_Dat_0(FWol,command));
+    }
+  if(command == *shadow)
+    {
+    //Already set that way
+    EVE_DL_Elided++;
+    return(FWol);
+    }
+  *shadow=command;
+#endif // (0 != EVE_DL_STATE_TRACKING)
+  return(EVE_Cmd_Dat_0(FWol,command));
+  }
+//===========================================================================
+#if (0 != EVE_DL_STATE_TRACKING)
+// Do we know there is no VERTEX_TRANSLATE in effect?
+static uint8_t _EVE_Vertex_Untranslated(void)
+  {
+#if (FT810 <= EVE_DEVICE)
+  return((EVE_ENC_VERTEX_TRANSLATE_X(0) == EVE_DL_State.vertex_translate_x)&&
+         (EVE_ENC_VERTEX_TRANSLATE_Y(0) == EVE_DL_State.vertex_translate_y));
+#else
+  return(1);
+#endif // (FT810 <= EVE_DEVICE)
+  }
+//---------------------------------------------------------------------------
+// Would a VERTEX2II land in the same place, on the same bitmap, as the
+// VERTEX2F it stands in for? VERTEX2II carries its own handle and cell,
+// so for bitmaps we have to know what those are.
+static uint8_t _EVE_Vertex2II_OK(void)
+  {
+  if((0 == EVE_DL_State.begin)||(0 == _EVE_Vertex_Untranslated()))
+    {
+    return(0);
+    }
+  if(EVE_ENC_BEGIN(EVE_BEGIN_BITMAPS) == EVE_DL_State.begin)
+    {
+    return((0 != EVE_DL_State.bitmap_handle)&&(0 != EVE_DL_State.cell));
+    }
+  return(1);
+  }
+#if (FT810 <= EVE_DEVICE)
+//---------------------------------------------------------------------------
+// Do x and y, scaled up by 2^shift, fit in the signed 15 bits of VERTEX2F?
+static uint8_t _EVE_Vertex_Fits(int16_t x, int16_t y, uint8_t shift)
+  {
+  int16_t
+    limit;
+  limit=16384>>shift;
+  return((-limit <= x)&&(x < limit)&&(-limit <= y)&&(y < limit));
+  }
+#endif // (FT810 <= EVE_DEVICE)
+#endif // (0 != EVE_DL_STATE_TRACKING)
+//---------------------------------------------------------------------------
+uint16_t EVE_Vertex(uint16_t FWol,
+                    int16_t x,
+                    int16_t y)
+  {
+#if (0 != EVE_DL_STATE_TRACKING)
+  if((0 == ((uint16_t)x & 0xFE00))&&
+     (0 == ((uint16_t)y & 0xFE00))&&
+     (0 != _EVE_Vertex2II_OK()))
+    {
+    FWol=_EVE_Cmd_send_32(FWol,EVE_ENC_VERTEX2II(x,y,
+                                                 EVE_DL_State.bitmap_handle,
+                                                 EVE_DL_State.cell));
+    _EVE_Cmd_End();
+    return(FWol);
+    }
+#if (FT810 <= EVE_DEVICE)
+  uint8_t
+    frac;
+  frac=(uint8_t)EVE_DL_State.vertex_format & 0x07;
+  //Stay in the current format if the vertex fits, changing it costs as
+  //much as the vertex.
+  if((0 == EVE_DL_State.vertex_format)||
+     (4 < frac)||
+     (0 == _EVE_Vertex_Fits(x,y,frac)))
+    {
+    //Whole pixels go out as they are, good for +/-16383.
+    FWol=EVE_DL_Dat_0(FWol, EVE_ENC_VERTEX_FORMAT(0));
+    frac=0;
+    }
+  FWol=_EVE_Cmd_send_32(FWol,EVE_ENC_VERTEX2F(x<<frac,y<<frac));
+  _EVE_Cmd_End();
+  return(FWol);
+#endif // (FT810 <= EVE_DEVICE)
+#endif // (0 != EVE_DL_STATE_TRACKING)
+  FWol=_EVE_Cmd_send_32(FWol,EVE_ENC_VERTEX2F(x*16,y*16));
+  _EVE_Cmd_End();
+  return(FWol);
+  }
+//---------------------------------------------------------------------------
+uint16_t EVE_Vertex_16(uint16_t FWol,
+                       int16_t x,
+                       int16_t y)
+  {
+#if (0 != EVE_DL_STATE_TRACKING)
+  if(0 == ((x|y) & 0x0F))
+    {
+    //On a whole pixel, so it might go as a VERTEX2II.
+    return(EVE_Vertex(FWol,x>>4,y>>4));
+    }
+#if (FT810 <= EVE_DEVICE)
+  uint8_t
+    shift;
+  shift=4-((uint8_t)EVE_DL_State.vertex_format & 0x07);
+  //The current format will do if it is at least as fine as the vertex
+  //needs and the vertex fits.
+  if((0 == EVE_DL_State.vertex_format)||
+     (4 < shift)||
+     (0 != ((x|y) & ((1<<shift)-1)))||
+     (0 == _EVE_Vertex_Fits(x>>shift,y>>shift,0)))
+    {
+    if(0 != _EVE_Vertex_Fits(x,y,0))
+      {
+      FWol=EVE_DL_Dat_0(FWol, EVE_ENC_VERTEX_FORMAT(4));
+      shift=0;
+      }
+    else
+      {
+      //Past the +/-1023 pixels 1/16 can reach, 1/8 pixel will have to do.
+      FWol=EVE_DL_Dat_0(FWol, EVE_ENC_VERTEX_FORMAT(3));
+      shift=1;
+      }
+    }
+  FWol=_EVE_Cmd_send_32(FWol,EVE_ENC_VERTEX2F(x>>shift,y>>shift));
+  _EVE_Cmd_End();
+  return(FWol);
+#endif // (FT810 <= EVE_DEVICE)
+#endif // (0 != EVE_DL_STATE_TRACKING)
+  FWol=_EVE_Cmd_send_32(FWol,EVE_ENC_VERTEX2F(x,y));
+  _EVE_Cmd_End();
+  return(FWol);
+  }
+#if (FT810 <= EVE_DEVICE)
+//---------------------------------------------------------------------------
+uint16_t EVE_Vertex_Translate(uint16_t FWol,
+                              int32_t x,
+                              int32_t y)
+  {
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_VERTEX_TRANSLATE_X(x));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_VERTEX_TRANSLATE_Y(y));
+  return(FWol);
+  }
+#endif // (FT810 <= EVE_DEVICE)
+//===========================================================================
 uint16_t EVE_Point(uint16_t FWol,
                    uint16_t point_x,
                    uint16_t point_y,
                    uint16_t ball_size)
   {
   // Select the size of the dot to draw
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_POINT_SIZE(ball_size));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_POINT_SIZE(ball_size));
   // Indicate to draw a point (dot)
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_BEGIN(EVE_BEGIN_POINTS));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BEGIN(EVE_BEGIN_POINTS));
   // Set the point center location
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_VERTEX2F(point_x,point_y));
+  FWol=EVE_Vertex_16(FWol,point_x,point_y);
   // End the point
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_END());
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_END());
 
   //Give the updated write pointer back to the caller
   return(FWol);
@@ -75,15 +378,15 @@ uint16_t EVE_Line(uint16_t FWol,
                   uint16_t width)
   {
   //Set the line width
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_LINE_WIDTH(width*16));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_LINE_WIDTH(width*16));
   // Start a line
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_BEGIN(EVE_BEGIN_LINES));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BEGIN(EVE_BEGIN_LINES));
   // Set the first point
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_VERTEX2F(x0*16,y0*16));
+  FWol=EVE_Vertex(FWol,x0,y0);
   // Set the second point
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_VERTEX2F(x1*16,y1*16));
+  FWol=EVE_Vertex(FWol,x1,y1);
   // End the line
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_END());
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_END());
   //Give the updated write pointer back to the caller
   return(FWol);
   }
@@ -95,15 +398,15 @@ uint16_t EVE_Filled_Rectangle(uint16_t FWol,
                               uint16_t y1)
   {
   //Set the line width (16/16 of a pixel--appears to be about as sharp as it gets)
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_LINE_WIDTH(16));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_LINE_WIDTH(16));
   // Start a rectangle
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_BEGIN(EVE_BEGIN_RECTS));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BEGIN(EVE_BEGIN_RECTS));
   // Set the first point
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_VERTEX2F(x0*16,y0*16));
+  FWol=EVE_Vertex(FWol,x0,y0);
   // Set the second point
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_VERTEX2F(x1*16,y1*16));
+  FWol=EVE_Vertex(FWol,x1,y1);
   // End the rectangle
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_END());
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_END());
   //Give the updated write pointer back to the caller
   return(FWol);
   }
@@ -116,78 +419,323 @@ uint16_t EVE_Open_Rectangle(uint16_t FWol,
                             uint16_t width)
   {
   //Set the line width
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_LINE_WIDTH(width*16));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_LINE_WIDTH(width*16));
   // Start a line set
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_BEGIN(EVE_BEGIN_LINES));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BEGIN(EVE_BEGIN_LINES));
   // Top
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_VERTEX2F(x0*16,y0*16));
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_VERTEX2F(x1*16,y0*16));
+  FWol=EVE_Vertex(FWol,x0,y0);
+  FWol=EVE_Vertex(FWol,x1,y0);
   //Right
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_VERTEX2F(x1*16,y0*16));
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_VERTEX2F(x1*16,y1*16));
+  FWol=EVE_Vertex(FWol,x1,y0);
+  FWol=EVE_Vertex(FWol,x1,y1);
   //Bottom
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_VERTEX2F(x1*16,y1*16));
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_VERTEX2F(x0*16,y1*16));
+  FWol=EVE_Vertex(FWol,x1,y1);
+  FWol=EVE_Vertex(FWol,x0,y1);
   //Left
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_VERTEX2F(x0*16,y1*16));
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_VERTEX2F(x0*16,y0*16));
+  FWol=EVE_Vertex(FWol,x0,y1);
+  FWol=EVE_Vertex(FWol,x0,y0);
   // End the line set
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_END());
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_END());
   //Give the updated write pointer back to the caller
   return(FWol);
   }
 //===========================================================================
-// Print text from a RAM string.
-uint16_t EVE_Text(uint16_t FWol,
-                  uint16_t x,
-                  uint16_t y,
-                  uint16_t Font,
-                  uint16_t Options,
-                  char *message)
+// The batches below pick one VERTEX_FORMAT for the whole run up front, so
+// that every vertex after it is a bare VERTEX2F sent straight into the
+// open command burst, with no per-vertex checks against the tracker.
+//
+// For whole pixels, format 0 on FT81x and later (the tracker knows about
+// the switch, so EVE_Vertex() carries on from there). Otherwise the
+// format is left at the 1/16 pixel it starts out as, which is all that
+// EVE_Vertex() expects without the tracker. Returns how far to shift the
+// coordinates up.
+static uint16_t _EVE_Vertex_Run_Pixels(uint16_t FWol,
+                                       uint8_t *shift)
+  {
+#if (0 != EVE_DL_STATE_TRACKING)
+#if (FT810 <= EVE_DEVICE)
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_VERTEX_FORMAT(0));
+  *shift=0;
+  return(FWol);
+#endif // (FT810 <= EVE_DEVICE)
+#endif // (0 != EVE_DL_STATE_TRACKING)
+  *shift=4;
+  return(FWol);
+  }
+//---------------------------------------------------------------------------
+// For 1/16 pixels, format 4, or format 3 if any of the vertices are past
+// the +/-1023 pixels that format 4 can reach. Returns how far to shift
+// the coordinates down.
+static uint16_t _EVE_Vertex_Run_16(uint16_t FWol,
+                                   const int16_t *xy,
+                                   uint16_t vertices,
+                                   uint8_t *shift)
+  {
+  *shift=0;
+#if (0 != EVE_DL_STATE_TRACKING)
+#if (FT810 <= EVE_DEVICE)
+  while(0 != vertices)
+    {
+    if(0 == _EVE_Vertex_Fits(xy[0],xy[1],0))
+      {
+      *shift=1;
+      break;
+      }
+    xy+=2;
+    vertices--;
+    }
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_VERTEX_FORMAT(4-*shift));
+#else
+  (void)xy;
+  (void)vertices;
+#endif // (FT810 <= EVE_DEVICE)
+#else
+  (void)xy;
+  (void)vertices;
+#endif // (0 != EVE_DL_STATE_TRACKING)
+  return(FWol);
+  }
+//---------------------------------------------------------------------------
+uint16_t EVE_Points(uint16_t FWol,
+                    const int16_t *xy,
+                    uint16_t count,
+                    uint16_t point_size,
+                    const uint16_t *sizes,
+                    const uint32_t *colors)
+  {
+  uint8_t
+    shift;
+  if(NULL == sizes)
+    {
+    //Same size for all of them
+    FWol=EVE_DL_Dat_0(FWol, EVE_ENC_POINT_SIZE(point_size));
+    }
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BEGIN(EVE_BEGIN_POINTS));
+  FWol=_EVE_Vertex_Run_16(FWol,xy,count,&shift);
+  while(0 != count)
+    {
+    if(NULL != sizes)
+      {
+      FWol=EVE_DL_Dat_0(FWol, EVE_ENC_POINT_SIZE(*sizes));
+      sizes++;
+      }
+    if(NULL != colors)
+      {
+      FWol=EVE_DL_Dat_0(FWol, *colors);
+      colors++;
+      }
+    FWol=_EVE_Cmd_send_32(FWol,EVE_ENC_VERTEX2F(xy[0]>>shift,xy[1]>>shift));
+    xy+=2;
+    count--;
+    }
+  _EVE_Cmd_End();
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_END());
+  //Give the updated write pointer back to the caller
+  return(FWol);
+  }
+//---------------------------------------------------------------------------
+uint16_t EVE_Lines(uint16_t FWol,
+                   const int16_t *xy,
+                   uint16_t count,
+                   uint16_t width,
+                   const uint32_t *colors)
+  {
+  uint8_t
+    shift;
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_LINE_WIDTH(width*16));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BEGIN(EVE_BEGIN_LINES));
+  FWol=_EVE_Vertex_Run_Pixels(FWol,&shift);
+  while(0 != count)
+    {
+    if(NULL != colors)
+      {
+      FWol=EVE_DL_Dat_0(FWol, *colors);
+      colors++;
+      }
+    FWol=_EVE_Cmd_send_32(FWol,EVE_ENC_VERTEX2F(xy[0]<<shift,xy[1]<<shift));
+    FWol=_EVE_Cmd_send_32(FWol,EVE_ENC_VERTEX2F(xy[2]<<shift,xy[3]<<shift));
+    xy+=4;
+    count--;
+    }
+  _EVE_Cmd_End();
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_END());
+  //Give the updated write pointer back to the caller
+  return(FWol);
+  }
+//---------------------------------------------------------------------------
+uint16_t EVE_Rects(uint16_t FWol,
+                   const int16_t *xy,
+                   uint16_t count,
+                   uint16_t width,
+                   const uint32_t *colors)
+  {
+  uint8_t
+    shift;
+  //The line width rounds the corners, 1 gives the same sharp edges as
+  //EVE_Filled_Rectangle()
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_LINE_WIDTH(width*16));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BEGIN(EVE_BEGIN_RECTS));
+  FWol=_EVE_Vertex_Run_Pixels(FWol,&shift);
+  while(0 != count)
+    {
+    if(NULL != colors)
+      {
+      FWol=EVE_DL_Dat_0(FWol, *colors);
+      colors++;
+      }
+    FWol=_EVE_Cmd_send_32(FWol,EVE_ENC_VERTEX2F(xy[0]<<shift,xy[1]<<shift));
+    FWol=_EVE_Cmd_send_32(FWol,EVE_ENC_VERTEX2F(xy[2]<<shift,xy[3]<<shift));
+    xy+=4;
+    count--;
+    }
+  _EVE_Cmd_End();
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_END());
+  //Give the updated write pointer back to the caller
+  return(FWol);
+  }
+//===========================================================================
+#if (0 != EVE_DRAW_BENCHMARK)
+// 1000 points, made up EVE_DRAW_BENCHMARK_BATCH at a time so the AVR has
+// the RAM for the coordinates.
+#define EVE_DRAW_BENCHMARK_POINTS (1000)
+#define EVE_DRAW_BENCHMARK_BATCH  (50)
+//---------------------------------------------------------------------------
+// Fill xy with a batch of points scattered over the screen, the same ones
+// every time for the same seed.
+static uint16_t EVE_Draw_Benchmark_Batch(int16_t *xy, uint16_t seed)
+  {
+  uint8_t
+    i;
+  for(i=0;i<EVE_DRAW_BENCHMARK_BATCH;i++)
+    {
+    seed=seed*25173+13849;
+    xy[2*i+0]=(int16_t)((seed>>4)%LCD_WIDTH)*16;
+    seed=seed*25173+13849;
+    xy[2*i+1]=(int16_t)((seed>>4)%LCD_HEIGHT)*16;
+    }
+  return(seed);
+  }
+//---------------------------------------------------------------------------
+// Build one list of the benchmark points, either way, and report how long
+// it took to get it to the EVE and how big it came out.
+static uint16_t EVE_Draw_Benchmark_Run(uint16_t FWol, uint8_t batched)
   {
-  //Combine Address_offset into then select the EVE
-  //and send the 24-bit address and operation flag.
-  _EVE_Select_and_Address(EVE_RAM_CMD|FWol,EVE_MEM_WRITE);
+  int16_t
+    xy[2*EVE_DRAW_BENCHMARK_BATCH];
+  uint16_t
+    seed;
+  uint16_t
+    done;
+  uint8_t
+    i;
+  uint32_t
+    start_us;
+  uint32_t
+    elapsed_us;
+  seed=1;
+  elapsed_us=0;
+  FWol=Wait_for_EVE_Execution_Complete(FWol);
+#if (0 != EVE_SPI_STATISTICS)
+  EVE_SPI_Bytes=0;
+#endif // (0 != EVE_SPI_STATISTICS)
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_CMD_DLSTART);
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_CLEAR(1,1,1));
+  for(done=0;done<EVE_DRAW_BENCHMARK_POINTS;done+=EVE_DRAW_BENCHMARK_BATCH)
+    {
+    //Making up the coordinates does not count.
+    seed=EVE_Draw_Benchmark_Batch(xy,seed);
+    start_us=micros();
+    if(0 != batched)
+      {
+      FWol=EVE_Points(FWol,xy,EVE_DRAW_BENCHMARK_BATCH,4*16,NULL,NULL);
+      }
+    else
+      {
+      for(i=0;i<EVE_DRAW_BENCHMARK_BATCH;i++)
+        {
+        FWol=EVE_Point(FWol,xy[2*i+0],xy[2*i+1],4*16);
+        }
+      }
+    elapsed_us+=micros()-start_us;
+    }
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_DISPLAY());
+  EVE_Cmd_Flush(FWol);
+  FWol=Wait_for_EVE_Execution_Complete(FWol);
+  DBG_STAT("  %s: %lu us, %u bytes of display list\n",
+           (0 != batched)?"EVE_Points()":"EVE_Point() ",
+           elapsed_us,
+           EVE_REG_Read_16(EVE_REG_CMD_DL));
+#if (0 != EVE_SPI_STATISTICS)
+  DBG_STAT("    %lu bytes over SPI\n",EVE_SPI_Bytes);
+#endif // (0 != EVE_SPI_STATISTICS)
+  return(FWol);
+  }
+//---------------------------------------------------------------------------
+uint16_t EVE_Draw_Benchmark(uint16_t FWol)
+  {
+  DBG_STAT("Drawing %u points:\n",EVE_DRAW_BENCHMARK_POINTS);
+  //The lists are built but never swapped in, so nothing shows.
+  FWol=EVE_Draw_Benchmark_Run(FWol,0);
+  FWol=EVE_Draw_Benchmark_Run(FWol,1);
+  return(FWol);
+  }
+#endif // (0 != EVE_DRAW_BENCHMARK)
+//===========================================================================
+// The text commands all send the string straight into the command FIFO as
+// it is read or formatted, so there is no copy of it in RAM.
+static uint16_t _EVE_Text_Start(uint16_t FWol,
+                                uint16_t x,
+                                uint16_t y,
+                                uint16_t Font,
+                                uint16_t Options)
+  {
+  //Select the EVE at the current offset (or continue the burst)
+  _EVE_Cmd_Start(FWol);
   //Send the EVE_ENC_CMD_TEXT command
-  _EVE_send_32(EVE_ENC_CMD_TEXT);
+  FWol=_EVE_Cmd_send_32(FWol,EVE_ENC_CMD_TEXT);
   //Send the parameters of the EVE_ENC_CMD_TEXT command
   //First is 32-bit combination of Y & X
-  _EVE_send_32((((uint32_t)y)<<16) | (x));
+  FWol=_EVE_Cmd_send_32(FWol,(((uint32_t)y)<<16) | (x));
   //Second is a combinations of options and the font=32
-  _EVE_send_32((((uint32_t)Options)<<16) | (Font));
-  //Keep track that we have written 12 bytes
-  FWol=(FWol+12)&0xFFF;
-  //Pipe out the string, could be 0 length.
-  uint8_t
-    this_character;
-  //Grab the next character from the string. If it is not
-  //null, send it out.
-  while(0 != (this_character=*message))
-    {
-    SPI.transfer(this_character);
-    //Point to the next character in the string
-    message++;
-    //Keep track that we have written a byte
-    FWol=(FWol+1)&0xFFF;
-    }
+  FWol=_EVE_Cmd_send_32(FWol,(((uint32_t)Options)<<16) | (Font));
+  return(FWol);
+  }
+//---------------------------------------------------------------------------
+static uint16_t _EVE_Text_End(uint16_t FWol)
+  {
   //Send the mandatory null terminator
-  SPI.transfer(0);
-  //Keep track that we have written a byte
-  FWol=(FWol+1)&0xFFF;
- 
+  FWol=_EVE_Cmd_send_8(FWol,0);
   //We need to ensure 4-byte alignment. Add nulls as necessary.
   while(0 != (FWol&0x03))
     {
-    SPI.transfer(0);
-    //Keep track that we have written a byte
-    FWol=(FWol+1)&0xFFF;
+    FWol=_EVE_Cmd_send_8(FWol,0);
     }
-  //De-select the EVE
-  SET_EVE_CS_NOT;
+  //De-select the EVE (or leave the burst open)
+  _EVE_Cmd_End();
+  //The coprocessor draws the text with its own BEGIN, bitmap handle etc.
+  EVE_DL_State_Forget();
   //Give the updated write pointer back to the caller
   return(FWol);
   }
-//===========================================================================
+//---------------------------------------------------------------------------
+// Print text from a RAM string.
+uint16_t EVE_Text(uint16_t FWol,
+                  uint16_t x,
+                  uint16_t y,
+                  uint16_t Font,
+                  uint16_t Options,
+                  char *message)
+  {
+  FWol=_EVE_Text_Start(FWol,x,y,Font,Options);
+  //Pipe out the string, could be 0 length.
+  while(0 != *message)
+    {
+    FWol=_EVE_Cmd_send_8(FWol,*message);
+    message++;
+    }
+  return(_EVE_Text_End(FWol));
+  }
+//---------------------------------------------------------------------------
 // The Arduino handles flash strings way differently than RAM, so we
 // need a special "F" function to handle flash strings.
 uint16_t EVE_TextF(uint16_t FWol,
@@ -197,23 +745,31 @@ uint16_t EVE_TextF(uint16_t FWol,
                    uint16_t Options,
                    const __FlashStringHelper *message)
   {
-  //Copy the flash string to RAM temporarily
-  char
-    tmp[256];
-  strcpy_P(tmp,(const char *)message);
-  //Put that string into to the EVE Display List
-  return(EVE_Text(FWol,
-                  x,
-                  y,
-                  Font,
-                  Options,
-                  tmp));
+  const char
+    *flash;
+  uint8_t
+    this_character;
+  FWol=_EVE_Text_Start(FWol,x,y,Font,Options);
+  flash=(const char *)message;
+  while(0 != (this_character=pgm_read_byte(flash)))
+    {
+    FWol=_EVE_Cmd_send_8(FWol,this_character);
+    flash++;
+    }
+  return(_EVE_Text_End(FWol));
   }
-//============================================================================
-// Don't call _EVE_PrintFF() directly, use EVE_PrintF() macro.
-//
-// ref http://playground.arduino.cc/Main/Printf
-//
+//---------------------------------------------------------------------------
+// EVE_Format() only passes the character, so the write pointer for
+// _EVE_PrintFF() is kept here.
+static uint16_t
+  EVE_PrintF_FWol;
+static void _EVE_PrintF_Output(char c)
+  {
+  EVE_PrintF_FWol=_EVE_Cmd_send_8(EVE_PrintF_FWol,c);
+  }
+//---------------------------------------------------------------------------
+// Don't call _EVE_PrintFF() directly, use EVE_PrintF() macro. See
+// EVE_Format() for the conversions.
 uint16_t _EVE_PrintFF(uint16_t FWol,
                       uint16_t x,
                       uint16_t y,
@@ -221,23 +777,113 @@ uint16_t _EVE_PrintFF(uint16_t FWol,
                       uint16_t Options,
                       const __FlashStringHelper *fmt, ... )
   {
-  //Use the variable argument functions to create the string
-  char
-    tmp[256]; // resulting string limited to 256 chars
   va_list
     args;
+  EVE_PrintF_FWol=_EVE_Text_Start(FWol,x,y,Font,Options);
   va_start(args, fmt );
-  vsnprintf_P(tmp, 256, (const char *)fmt, args);
+  EVE_Format(_EVE_PrintF_Output,fmt,args);
   va_end (args);
-  //Put that string into to the EVE Display List
-
-  return(EVE_Text(FWol,
-                  x,
-                  y,
-                  Font,
-                  Options,
-                  tmp));
-  }  
+  return(_EVE_Text_End(EVE_PrintF_FWol));
+  }
+//===========================================================================
+uint16_t EVE_Number(uint16_t FWol,
+                    uint16_t x,
+                    uint16_t y,
+                    uint16_t Font,
+                    uint16_t Options,
+                    int32_t value)
+  {
+  _EVE_Cmd_Start(FWol);
+  FWol=_EVE_Cmd_send_32(FWol,EVE_ENC_CMD_NUMBER);
+  FWol=_EVE_Cmd_send_32(FWol,(((uint32_t)y)<<16) | (x));
+  FWol=_EVE_Cmd_send_32(FWol,(((uint32_t)Options)<<16) | (Font));
+  FWol=_EVE_Cmd_send_32(FWol,(uint32_t)value);
+  _EVE_Cmd_End();
+  //Drawn like text, with the coprocessor's own BEGIN and handle.
+  EVE_DL_State_Forget();
+  return(FWol);
+  }
+//---------------------------------------------------------------------------
+#if (FT810 <= EVE_DEVICE)
+uint16_t EVE_Number_Base(uint16_t FWol,
+                         uint16_t x,
+                         uint16_t y,
+                         uint16_t Font,
+                         uint16_t Options,
+                         uint8_t base,
+                         int32_t value)
+  {
+  //The base is coprocessor state that outlives the display list, so it
+  //goes straight back to 10 rather than being tracked.
+  if(10 != base)
+    {
+    FWol=EVE_Cmd_Dat_1(FWol,EVE_ENC_CMD_SETBASE,base);
+    }
+  FWol=EVE_Number(FWol,x,y,Font,Options,value);
+  if(10 != base)
+    {
+    FWol=EVE_Cmd_Dat_1(FWol,EVE_ENC_CMD_SETBASE,10);
+    }
+  return(FWol);
+  }
+#endif // (FT810 <= EVE_DEVICE)
+//---------------------------------------------------------------------------
+uint16_t EVE_Number_Fixed(uint16_t FWol,
+                          uint16_t x,
+                          uint16_t y,
+                          uint16_t Font,
+                          uint16_t Options,
+                          int32_t value,
+                          uint8_t decimals)
+  {
+  //Only the positioning options mean anything to CMD_TEXT.
+  Options&=EVE_OPT_CENTER|EVE_OPT_RIGHTX;
+  if(9 < decimals)
+    {
+    decimals=9;
+    }
+#if (BT815 <= EVE_DEVICE)
+  uint32_t
+    scale;
+  uint32_t
+    magnitude;
+  uint8_t
+    i;
+  scale=1;
+  for(i=0;i<decimals;i++)
+    {
+    scale*=10;
+    }
+  magnitude=(value < 0)?-(uint32_t)value:(uint32_t)value;
+  //"-%d.%0<decimals>d" with the whole and fraction parts as arguments.
+  FWol=_EVE_Text_Start(FWol,x,y,Font,Options|EVE_OPT_FORMAT);
+  if(value < 0)
+    {
+    FWol=_EVE_Cmd_send_8(FWol,'-');
+    }
+  FWol=_EVE_Cmd_send_8(FWol,'%');
+  FWol=_EVE_Cmd_send_8(FWol,'u');
+  if(0 != decimals)
+    {
+    FWol=_EVE_Cmd_send_8(FWol,'.');
+    FWol=_EVE_Cmd_send_8(FWol,'%');
+    FWol=_EVE_Cmd_send_8(FWol,'0');
+    FWol=_EVE_Cmd_send_8(FWol,'0'+decimals);
+    FWol=_EVE_Cmd_send_8(FWol,'u');
+    }
+  //The NUL and padding, then the arguments follow the string.
+  FWol=_EVE_Text_End(FWol);
+  FWol=_EVE_Cmd_send_32(FWol,magnitude/scale);
+  if(0 != decimals)
+    {
+    FWol=_EVE_Cmd_send_32(FWol,magnitude%scale);
+    }
+  _EVE_Cmd_End();
+  return(FWol);
+#else // (BT815 <= EVE_DEVICE)
+  return(EVE_PrintF(FWol,x,y,Font,Options,"%.*lk",decimals,value));
+#endif // (BT815 <= EVE_DEVICE)
+  }
 //===========================================================================
 uint16_t Start_Busy_Spinner_Screen(uint16_t FWol,
                                    uint32_t Clear_Color,
@@ -249,19 +895,19 @@ uint16_t Start_Busy_Spinner_Screen(uint16_t FWol,
   FWol=Wait_for_EVE_Execution_Complete(FWol);
   //========== START THE DISPLAY LIST ==========
   // Start the display list
-  FWol=EVE_Cmd_Dat_0(FWol, (EVE_ENC_CMD_DLSTART));
+  FWol=EVE_DL_Dat_0(FWol, (EVE_ENC_CMD_DLSTART));
   // Set the default clear color to black
-  FWol=EVE_Cmd_Dat_0(FWol, Clear_Color);
+  FWol=EVE_DL_Dat_0(FWol, Clear_Color);
   // Clear the screen - this and the previous prevent artifacts between lists
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_CLEAR(1 /*CLR_COL*/,1 /*CLR_STN*/,1 /*CLR_TAG*/));
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_CLEAR(1 /*CLR_COL*/,1 /*CLR_STN*/,1 /*CLR_TAG*/));
   //Solid color -- not transparent
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_COLOR_A(255));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_COLOR_A(255));
 
   //========== ADD GRAPHIC ITEMS TO THE DISPLAY LIST ==========
   // Set the drawing for the text
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     Text_Color);
+  FWol=EVE_DL_Dat_0(FWol,
+                    Text_Color);
   //Display the caller's message at the center of the screen using bitmap handle 27
   FWol=EVE_TextF(FWol,
                  LCD_WIDTH/2,
@@ -270,7 +916,7 @@ uint16_t Start_Busy_Spinner_Screen(uint16_t FWol,
                  EVE_OPT_CENTER,
                  message);
   // Set the drawing color for the spinner
-  FWol=EVE_Cmd_Dat_0(FWol, Spinner_Color);
+  FWol=EVE_DL_Dat_0(FWol, Spinner_Color);
   //Send the spinner go command
   FWol=EVE_Cmd_Dat_2(FWol,
                      EVE_ENC_CMD_SPINNER,
@@ -278,13 +924,11 @@ uint16_t Start_Busy_Spinner_Screen(uint16_t FWol,
                      //scale, style
                      (((uint32_t)1)<<16) | (0));
   // Instruct the graphics processor to show the list
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_DISPLAY());
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_DISPLAY());
   // Make this list active
   FWol=EVE_Cmd_Dat_0(FWol, (EVE_ENC_CMD_SWAP));
-  // Update the ring buffer pointer so the graphics processor starts
-  // executing.
-  // Note: this is a write to register space not EVE_RAM_CMD space.
-  EVE_REG_Write_16(EVE_REG_CMD_WRITE, FWol);
+  // Get the graphics processor executing the list.
+  EVE_Cmd_Flush(FWol);
   //We are done, return the updated address.
   return(FWol);
   }
@@ -298,17 +942,17 @@ uint16_t Stop_Busy_Spinner_Screen(uint16_t FWol,
   FWol=Wait_for_EVE_Execution_Complete(FWol);
   //========== START THE DISPLAY LIST ==========
   // Start the display list
-  FWol=EVE_Cmd_Dat_0(FWol,
-                       EVE_ENC_CMD_DLSTART);
+  FWol=EVE_DL_Dat_0(FWol,
+                      EVE_ENC_CMD_DLSTART);
   // Set the default clear color to black
-  FWol=EVE_Cmd_Dat_0(FWol,
-                       Clear_Color);
+  FWol=EVE_DL_Dat_0(FWol,
+                      Clear_Color);
   // Clear the screen - this and the previous prevent artifacts between lists
-  FWol=EVE_Cmd_Dat_0(FWol,
-                       EVE_ENC_CLEAR(1 /*CLR_COL*/,1 /*CLR_STN*/,1 /*CLR_TAG*/));
+  FWol=EVE_DL_Dat_0(FWol,
+                      EVE_ENC_CLEAR(1 /*CLR_COL*/,1 /*CLR_STN*/,1 /*CLR_TAG*/));
   //Solid color -- not transparent
-  FWol=EVE_Cmd_Dat_0(FWol,
-                       EVE_ENC_COLOR_A(255));
+  FWol=EVE_DL_Dat_0(FWol,
+                      EVE_ENC_COLOR_A(255));
 
   //========== STOP THE SPINNER ==========
   FWol=EVE_Cmd_Dat_0(FWol,
@@ -316,8 +960,8 @@ uint16_t Stop_Busy_Spinner_Screen(uint16_t FWol,
 
   //========== ADD GRAPHIC ITEMS TO THE DISPLAY LIST ==========
   // Set the drawing for the text
-  FWol=EVE_Cmd_Dat_0(FWol,
-                       Text_Color);
+  FWol=EVE_DL_Dat_0(FWol,
+                      Text_Color);
 
   //Display the caller's message at the center of the screen using bitmap handle 25
   FWol=EVE_TextF(FWol,
@@ -328,15 +972,13 @@ uint16_t Stop_Busy_Spinner_Screen(uint16_t FWol,
                  message);
 
   // Instruct the graphics processor to show the list
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_DISPLAY());
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_DISPLAY());
   // Make this list active
   FWol=EVE_Cmd_Dat_0(FWol,
                        EVE_ENC_CMD_SWAP);
-  // Update the ring buffer pointer so the graphics processor starts
-  // executing.
-  // Note: this is a write to register space not EVE_RAM_CMD space.
-  EVE_REG_Write_16(EVE_REG_CMD_WRITE, FWol);
+  // Get the graphics processor executing the list.
+  EVE_Cmd_Flush(FWol);
   //We are done, return the updated address.
   return(FWol);
   }
@@ -348,20 +990,20 @@ uint16_t Calibrate_Touch(uint16_t FWol)
   FWol=Wait_for_EVE_Execution_Complete(FWol);
   //========== START THE DISPLAY LIST ==========
   // Start the display list
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_CMD_DLSTART);
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_CMD_DLSTART);
   // Set the drawing color to white
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_COLOR_RGB(0xFF,0xFF,0xFF));
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_COLOR_RGB(0xFF,0xFF,0xFF));
   //Solid color -- not transparent
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_COLOR_A(255));
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_COLOR_A(255));
   // Set the default clear color to blue
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_CLEAR_COLOR_RGB(0,0,0xFF));
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_CLEAR_COLOR_RGB(0,0,0xFF));
   // Clear the screen - this and the previous prevent artifacts between lists
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_CLEAR(1 /*CLR_COL*/,1 /*CLR_STN*/,1 /*CLR_TAG*/));
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_CLEAR(1 /*CLR_COL*/,1 /*CLR_STN*/,1 /*CLR_TAG*/));
   FWol=EVE_PrintF(FWol,
                   LCD_WIDTH/2,
                   LCD_HEIGHT/2,
@@ -372,18 +1014,238 @@ uint16_t Calibrate_Touch(uint16_t FWol)
                      EVE_ENC_CMD_CALIBRATE);
   //========== FINSH AND SHOW THE DISPLAY LIST ==========
   // Instruct the graphics processor to show the list
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_DISPLAY());
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_DISPLAY());
   // Make this list active
   FWol=EVE_Cmd_Dat_0(FWol,
                      EVE_ENC_CMD_SWAP);
-  // Update the ring buffer pointer so the graphics processor starts executing
-  EVE_REG_Write_16(EVE_REG_CMD_WRITE, FWol);
+  // Get the graphics processor executing the list.
+  EVE_Cmd_Flush(FWol);
   //Wait for the user to finish calibration.
   FWol=Wait_for_EVE_Execution_Complete(FWol);
   return(FWol);
   }
 //===========================================================================
+void EVE_DL_Cache_Initialize(EVE_DL_Cache *cache,
+                             uint16_t capacity)
+  {
+  //CMD_APPEND wants a 4-byte aligned address.
+  cache->RAM_G_Address=EVE_RAM_G_Alloc(capacity,EVE_RAM_G_ALIGN_DL);
+  cache->capacity=capacity;
+  cache->length=0;
+  if(EVE_RAM_G_NONE == cache->RAM_G_Address)
+    {
+    //No room, so it is never recorded and the caller keeps sending it
+    //the long way.
+    cache->capacity=0;
+    }
+  }
+//---------------------------------------------------------------------------
+void EVE_DL_Cache_Release(EVE_DL_Cache *cache)
+  {
+  if(EVE_RAM_G_NONE != cache->RAM_G_Address)
+    {
+    EVE_RAM_G_Free(cache->RAM_G_Address);
+    cache->RAM_G_Address=EVE_RAM_G_NONE;
+    }
+  cache->capacity=0;
+  cache->length=0;
+  }
+//---------------------------------------------------------------------------
+uint16_t EVE_DL_Cache_Record_Start(uint16_t FWol)
+  {
+  //Start from an empty display list, so EVE_REG_CMD_DL will tell us how
+  //much was recorded.
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_CMD_DLSTART);
+  return(FWol);
+  }
+//---------------------------------------------------------------------------
+uint16_t EVE_DL_Cache_Record_End(uint16_t FWol,
+                                 EVE_DL_Cache *cache)
+  {
+  uint16_t
+    length;
+  //Let the coprocessor finish writing the commands into RAM_DL.
+  EVE_Cmd_Flush(FWol);
+  FWol=Wait_for_EVE_Execution_Complete(FWol);
+  //That is how much it wrote
+  length=EVE_REG_Read_16(EVE_REG_CMD_DL);
+  if((0 == length)||(cache->capacity < length))
+    {
+    DBG_STAT("EVE_DL_Cache_Record_End(): %u bytes recorded, room for %u. Not caching.\n",
+             length,cache->capacity);
+    //Do not try again, the caller will keep sending it the long way. The
+    //block is no use to it now, so give it back.
+    EVE_DL_Cache_Release(cache);
+    return(FWol);
+    }
+  //Copy it out of RAM_DL before the next CMD_DLSTART starts over.
+  FWol=EVE_Cmd_Dat_3(FWol,
+                     EVE_ENC_CMD_MEMCPY,
+                     cache->RAM_G_Address,
+                     EVE_RAM_DL,
+                     length);
+  EVE_Cmd_Flush(FWol);
+  FWol=Wait_for_EVE_Execution_Complete(FWol);
+  cache->length=length;
+  DBG_GEEK("EVE_DL_Cache_Record_End(): %u bytes cached at 0x%08lX\n",
+           length,cache->RAM_G_Address);
+  return(FWol);
+  }
+//---------------------------------------------------------------------------
+uint16_t EVE_DL_Cache_Append(uint16_t FWol,
+                             EVE_DL_Cache *cache)
+  {
+  if(0 != cache->length)
+    {
+    //One command instead of the whole list.
+    FWol=EVE_Cmd_Dat_2(FWol,
+                       EVE_ENC_CMD_APPEND,
+                       cache->RAM_G_Address,
+                       cache->length);
+    //Whatever state the cached commands left behind, we do not know it.
+    EVE_DL_State_Forget();
+    }
+  return(FWol);
+  }
+//===========================================================================
+// What each registered handle is bound to. Entry 0 is handle 1. A width
+// of 0 marks a free entry (the source can be 0).
+static struct
+  {
+  uint32_t source;
+  uint16_t stride;
+  uint16_t width;
+  uint16_t height;
+  uint8_t format;
+  uint8_t filter;
+  } EVE_Bitmaps[EVE_BITMAP_HANDLES];
+//---------------------------------------------------------------------------
+uint8_t EVE_Bitmap_Register(uint8_t handle,
+                            uint32_t source,
+                            uint8_t format,
+                            uint16_t stride,
+                            uint16_t width,
+                            uint16_t height,
+                            uint8_t filter)
+  {
+  uint8_t
+    i;
+  if(0 == handle)
+    {
+    for(i=0;i<EVE_BITMAP_HANDLES;i++)
+      {
+      if(0 == EVE_Bitmaps[i].width)
+        {
+        handle=i+1;
+        break;
+        }
+      }
+    if(0 == handle)
+      {
+      DBG_STAT("EVE_Bitmap_Register(): all %u handles are taken.\n",
+               EVE_BITMAP_HANDLES);
+      return(0);
+      }
+    }
+  i=handle-1;
+  EVE_Bitmaps[i].source=source;
+  EVE_Bitmaps[i].stride=stride;
+  EVE_Bitmaps[i].width=width;
+  EVE_Bitmaps[i].height=height;
+  EVE_Bitmaps[i].format=format;
+  EVE_Bitmaps[i].filter=filter;
+  DBG_GEEK("EVE_Bitmap_Register(): handle %u is %ux%u at 0x%08lX\n",
+           handle,width,height,source);
+  return(handle);
+  }
+//---------------------------------------------------------------------------
+uint16_t EVE_Bitmap_Prologue(uint16_t FWol)
+  {
+  uint8_t
+    i;
+  for(i=0;i<EVE_BITMAP_HANDLES;i++)
+    {
+    if(0 == EVE_Bitmaps[i].width)
+      {
+      continue;
+      }
+    FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BITMAP_HANDLE(i+1));
+    FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BITMAP_SOURCE(EVE_Bitmaps[i].source));
+    FWol=EVE_DL_Dat_0(FWol,
+                      EVE_ENC_BITMAP_LAYOUT(EVE_Bitmaps[i].format,
+                                            EVE_Bitmaps[i].stride,
+                                            EVE_Bitmaps[i].height));
+    FWol=EVE_DL_Dat_0(FWol,
+                      EVE_ENC_BITMAP_SIZE(EVE_Bitmaps[i].filter,
+                                          EVE_WRAP_BORDER,
+                                          EVE_WRAP_BORDER,
+                                          EVE_Bitmaps[i].width,
+                                          EVE_Bitmaps[i].height));
+#if (FT810 <= EVE_DEVICE)
+    //Only the registry sets these handles up, so the high bits only need
+    //to be sent when they are not 0.
+    if((1023 < EVE_Bitmaps[i].stride)||(511 < EVE_Bitmaps[i].height))
+      {
+      FWol=EVE_DL_Dat_0(FWol,
+                        EVE_ENC_BITMAP_LAYOUT_H(EVE_Bitmaps[i].stride>>10,
+                                                EVE_Bitmaps[i].height>>9));
+      }
+    if((511 < EVE_Bitmaps[i].width)||(511 < EVE_Bitmaps[i].height))
+      {
+      FWol=EVE_DL_Dat_0(FWol,
+                        EVE_ENC_BITMAP_SIZE_H(EVE_Bitmaps[i].width>>9,
+                                              EVE_Bitmaps[i].height>>9));
+      }
+#endif // (FT810 <= EVE_DEVICE)
+    }
+  //Leave handle 0 selected for everybody else.
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BITMAP_HANDLE(0));
+  return(FWol);
+  }
+//---------------------------------------------------------------------------
+uint16_t EVE_Bitmap_Draw(uint16_t FWol,
+                         uint8_t handle,
+                         int16_t x,
+                         int16_t y)
+  {
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BEGIN(EVE_BEGIN_BITMAPS));
+#if (0 != EVE_DL_STATE_TRACKING)
+  //VERTEX2II names the handle itself, no BITMAP_HANDLE needed.
+  if((0 == ((uint16_t)x & 0xFE00))&&
+     (0 == ((uint16_t)y & 0xFE00))&&
+     (0 != EVE_DL_State.cell)&&
+     (0 != _EVE_Vertex_Untranslated()))
+    {
+    FWol=_EVE_Cmd_send_32(FWol,EVE_ENC_VERTEX2II(x,y,
+                                                 handle,
+                                                 EVE_DL_State.cell));
+    _EVE_Cmd_End();
+    }
+  else
+#endif // (0 != EVE_DL_STATE_TRACKING)
+    {
+    FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BITMAP_HANDLE(handle));
+    FWol=EVE_Vertex(FWol,x,y);
+    }
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_END());
+  return(FWol);
+  }
+//---------------------------------------------------------------------------
+uint16_t EVE_Bitmap_Transform(uint16_t FWol,
+                              const EVE_Matrix *m)
+  {
+  //16.16 rounded to the 8.8 of A, B, D, E and the 15.8 of C, F
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BITMAP_TRANSFORM_A((m->a+0x80)>>8));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BITMAP_TRANSFORM_B((m->b+0x80)>>8));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BITMAP_TRANSFORM_C((m->c+0x80)>>8));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BITMAP_TRANSFORM_D((m->d+0x80)>>8));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BITMAP_TRANSFORM_E((m->e+0x80)>>8));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BITMAP_TRANSFORM_F((m->f+0x80)>>8));
+  return(FWol);
+  }
+//===========================================================================
 #if (1==LOGO_DEMO)
 #if (0==LOGO_PNG_0_ARGB2_1)
 uint16_t EVE_Load_PNG_to_RAM_G(uint16_t FWol,
@@ -419,11 +1281,13 @@ uint16_t EVE_Load_PNG_to_RAM_G(uint16_t FWol,
   RAM_G_Needed=((*Image_Width)*(*Image_Height))<<1;
 
   //See if there is room
-  if((EVE_RAM_G_SIZE - *RAM_G_Address) < RAM_G_Needed)
+  *RAM_G_Address=EVE_RAM_G_Alloc(RAM_G_Needed,
+                                 EVE_RAM_G_ALIGN_FOR_FORMAT(EVE_FORMAT_RGB565));
+  if(EVE_RAM_G_NONE == *RAM_G_Address)
     {
-    DBG_STAT("EVE_Load_PNG_to_RAM_G(): Image is %lu bytes long, but only %lu are available.\n",
-              RAM_G_Needed,EVE_RAM_G_SIZE-(*RAM_G_Address));
-    //Bail out with the address unchanged.
+    DBG_STAT("EVE_Load_PNG_to_RAM_G(): Image is %lu bytes long, but there is no room for it.\n",
+              RAM_G_Needed);
+    //Bail out with nothing loaded.
     return(FWol);
     }
 
@@ -439,62 +1303,13 @@ uint16_t EVE_Load_PNG_to_RAM_G(uint16_t FWol,
   //We need to ensure 4-byte alignment.
   PNG_length=(PNG_length+0x03)&0xFFFFFFFC;
 
-  //Pipe out PNG_length of data from PNG_data. Use chunks so we
-  //can handle images larger than 4K.
-  while(0 != PNG_length)
-    {
-    //What is the maximum we can transfer in this block?
-    uint32_t
-      bytes_this_block;
-    uint32_t
-      bytes_free;
-
-    //See how much room is available in the EVE_RAM_CMD
-    bytes_free=Get_Free_CMD_Space(FWol);
-
-    DBG_GEEK("EVE_Load_PNG_to_RAM_G(): PNG_length= %lu bytes_free = %lu ",PNG_length,bytes_free);
-
-    if(PNG_length <= bytes_free)
-      {
-      //Everything will fit in the available space.
-      bytes_this_block=PNG_length;
-      }
-    else
-      {
-      //It won't all fit, transfer the maximum amount.
-      bytes_this_block=bytes_free;
-      }
-    DBG_GEEK("bytes_this_block = %lu \n",bytes_this_block);
-
-    //Set the address in EVE_RAM_CMD for this block
-    _EVE_Select_and_Address((uint32_t)EVE_RAM_CMD|(uint32_t)FWol,
-                              EVE_MEM_WRITE);
-
-    // Keep track that we are about to send bytes_this_block bytes.
-    FWol=(FWol+bytes_this_block)&0xFFF;
-    PNG_length-=bytes_this_block;
-
-    while(0!=bytes_this_block)
-      {
-      SPI.transfer(pgm_read_byte(PNG_data));
-      PNG_data++;
-      bytes_this_block--;
-      }
-    //Now we need to end this command.
-    SET_EVE_CS_NOT;
-    //OK, the data is in the EVE_RAM_CMD circular buffer, ask the chip
-    //to process it.
-    EVE_REG_Write_16(EVE_REG_CMD_WRITE, FWol);
-    //Now wait for it to catch up
-    FWol=Wait_for_EVE_Execution_Complete(FWol);
-    }
-
-  //Mark this block of RAM_G used in the callers varaible.
-  *RAM_G_Address+=RAM_G_Needed;
-
-  //To be safe, force RAM_G_Address to be 8-byte aligned (maybe not
-  //needed, certainly does not hurt).
-  *RAM_G_Address=(*RAM_G_Address+0x07)&0xFFFFFFF8;
+  //Pipe out PNG_length of data straight from flash. The command writer
+  //takes care of the ring filling up and wrapping, so this can be
+  //larger than 4K.
+  FWol=EVE_Cmd_Stream_P(FWol,PNG_data,PNG_length);
+  //Now wait for the chip to finish with it.
+  EVE_Cmd_Flush(FWol);
+  FWol=Wait_for_EVE_Execution_Complete(FWol);
 
   //Use a read-back to verify what we already calculated
   uint32_t
@@ -510,20 +1325,19 @@ uint16_t EVE_Load_PNG_to_RAM_G(uint16_t FWol,
                                          &Read_Back_RAM_G_First_Available,
                                          &Read_Back_Width,
                                          &Read_Back_Height);
-  if((*RAM_G_Address!=Read_Back_RAM_G_First_Available)||
+  if((*RAM_G_Address+RAM_G_Needed!=Read_Back_RAM_G_First_Available)||
      (*Image_Width!=Read_Back_Width)||
      (*Image_Height!=Read_Back_Height))
     {
     DBG_STAT("EVE_Load_PNG_to_RAM_G(): Read-back Error.\n");
     DBG_STAT("  Calc RAM_G %lu Read Back RAM_G = %lu\n",
-                 *RAM_G_Address,Read_Back_RAM_G_First_Available);
+                 *RAM_G_Address+RAM_G_Needed,Read_Back_RAM_G_First_Available);
     DBG_STAT("  Calc Wide %lu Read Back Wide = %lu\n",
                  *Image_Width,Read_Back_Width);
     DBG_STAT("  Calc High %lu Read Back High = %lu\n",
                  *Image_Height,Read_Back_Height);
     }
 
-  //Return the updated address
   return(FWol);
   }
 #endif // (0==LOGO_PNG_0_ARGB2_1)
@@ -534,7 +1348,19 @@ uint16_t EVE_Inflate_to_RAM_G(uint16_t FWol,
                               uint32_t data_length,
                               uint32_t *RAM_G_Address)
   {
+  uint32_t
+    RAM_G_End;
+  uint16_t
+    copro_resets;
   DBG_GEEK("\n");
+  //How big it is going to be is only known afterwards, so take all the
+  //room there is, and give back what is left over.
+  *RAM_G_Address=EVE_RAM_G_Alloc(EVE_RAM_G_Largest_Free(EVE_RAM_G_ALIGN_DL),
+                                 EVE_RAM_G_ALIGN_DL);
+  if(EVE_RAM_G_NONE == *RAM_G_Address)
+    {
+    return(FWol);
+    }
   //Load and INFLATE data from flash to RAM_G
   //Write the EVE_ENC_CMD_INFLATE and parameters
   FWol=EVE_Cmd_Dat_1(FWol,
@@ -544,66 +1370,30 @@ uint16_t EVE_Inflate_to_RAM_G(uint16_t FWol,
                        *RAM_G_Address);
   //We need to ensure 4-byte alignment.
   data_length=(data_length+0x03)&0xFFFFFFFC;
-  //Pipe out data_length of data from data_address. Use chunks so we
-  //can handle images larger than 4K.
-  while(0 != data_length)
-    {
-    //What is the maximum we can transfer in this block?
-    uint32_t
-      bytes_this_block;
-    uint32_t
-      bytes_free;
-
-    //See how much room is available in the EVE_RAM_CMD
-    bytes_free=Get_Free_CMD_Space(FWol);
-
-    DBG_GEEK("  EVE_Inflate_to_RAM_G(): data_length= %lu bytes_free = %lu ",data_length,bytes_free);
-
-    if(data_length <= bytes_free)
-      {
-      //Everything will fit in the available space.
-      bytes_this_block=data_length;
-      }
-    else
-      {
-      //It won't all fit, transfer the maximum amount.
-      bytes_this_block=bytes_free;
-      }
-    DBG_GEEK("bytes_this_block = %lu \n",bytes_this_block);
-
-    //Set the address in EVE_RAM_CMD for this block
-    _EVE_Select_and_Address((uint32_t)EVE_RAM_CMD|(uint32_t)FWol,
-                              EVE_MEM_WRITE);
-
-    // Keep track that we are about to send bytes_this_block bytes.
-    FWol=(FWol+bytes_this_block)&0xFFF;
-    data_length-=bytes_this_block;
-
-    while(0!=bytes_this_block)
-      {
-      SPI.transfer(pgm_read_byte(Flash_Data));
-      Flash_Data++;
-      bytes_this_block--;
-      }
-    //Now we need to end this command.
-    SET_EVE_CS_NOT;
-    //OK, the data is in the EVE_RAM_CMD circular buffer, ask the chip
-    //to process it.
-    EVE_REG_Write_16(EVE_REG_CMD_WRITE, FWol);
-    //Now wait for it to catch up
-    FWol=Wait_for_EVE_Execution_Complete(FWol);
+  //Pipe out data_length of data straight from flash. The command writer
+  //takes care of the ring filling up and wrapping, so this can be
+  //larger than 4K.
+  FWol=EVE_Cmd_Stream_P(FWol,Flash_Data,data_length);
+  //Now wait for the chip to finish with it.
+  EVE_Cmd_Flush(FWol);
+  copro_resets=EVE_Copro_Resets;
+  FWol=Wait_for_EVE_Execution_Complete(FWol);
+  if(copro_resets != EVE_Copro_Resets)
+    {
+    //Bad data, the coprocessor faulted and was reset. Nothing good was
+    //written, and CMD_GETPTR would not know where it stopped anyway.
+    DBG_STAT("EVE_Inflate_to_RAM_G(): INFLATE faulted.\n");
+    EVE_RAM_G_Free(*RAM_G_Address);
+    *RAM_G_Address=EVE_RAM_G_NONE;
+    return(FWol);
     }
 
   //Get the first free address in RAM_G from after the inflated data, and
-  //push it into the caller's varaible.
+  //keep the block up to there.
   FWol=Get_RAM_G_Pointer_After_INFLATE(FWol,
-                                       RAM_G_Address);
+                                       &RAM_G_End);
+  EVE_RAM_G_Trim(*RAM_G_Address,RAM_G_End-*RAM_G_Address);
 
-  //To be safe, force RAM_G_Address to be 8-byte aligned (maybe not
-  //needed, certainly does not hurt).
-  *RAM_G_Address=(*RAM_G_Address+0x07)&0xFFFFFFF8;
-
-  //Return the updated address
   return(FWol);
   }
 #endif // (1==LOGO_PNG_0_ARGB2_1)
@@ -613,34 +1403,57 @@ uint16_t EVE_Inflate_to_RAM_G(uint16_t FWol,
 // This reads a file from the uSD card and writes it directly
 // into RAM_G, not bothering with the command processor.
 //---------------------------------------------------------------------------
-void EVE_Load_File_To_RAM_G(uint32_t RAM_G_Address,
-                            const char *File_Name,
-                            uint32_t *RAM_G_Used)
+uint32_t EVE_Load_File_To_RAM_G(const char *File_Name,
+                                uint8_t alignment,
+                                uint32_t *RAM_G_Used)
   {
+  uint32_t
+    RAM_G_Start;
+  uint32_t
+    RAM_G_Address;
   DBG_GEEK("\n");
+  *RAM_G_Used=0;
+  //The uSD shares the SPI bus, so make sure the EVE is not still
+  //selected from an open command burst.
+  EVE_Cmd_Burst_Close();
   File
     binary_file;
   binary_file = SD.open(File_Name,FILE_READ);    
   if(0 == binary_file)
     {
     DBG_STAT("  EVE_Load_File_To_RAM_G(): Can't open \"%s\".\n",File_Name);
-    return;
+    return(EVE_RAM_G_NONE);
     }
 
-  //Here would be a good place to do sanity checks with the size
-  //of the file vs remaining RAM_G space. You would have to pass
-  //in the available RAM_G.
   uint32_t
     bytes_remaining;
   bytes_remaining=binary_file.size();
   DBG_GEEK("  EVE_Load_File_To_RAM_G: found %s size: %lu\n",
            binary_file.name(),binary_file.size());
-  //Inform our caller of how much of their RAM_G we are soaking up.
+  //Find it a home.
+  RAM_G_Start=EVE_RAM_G_Alloc(bytes_remaining,alignment);
+  if(EVE_RAM_G_NONE == RAM_G_Start)
+    {
+    binary_file.close();
+    return(EVE_RAM_G_NONE);
+    }
+  RAM_G_Address=RAM_G_Start;
+  //Inform our caller of how much RAM_G we are soaking up.
   *RAM_G_Used=bytes_remaining;
-  //Limited RAM on the Arduino, so use a reasonable block size
-  #define CHUNK_SIZE (256)
+#if (0 != EVE_LOAD_REPORT)
+  uint32_t
+    start_us;
+  uint32_t
+    mark_us;
+  uint32_t
+    sd_us;
+  start_us=micros();
+  sd_us=0;
+#endif // (0 != EVE_LOAD_REPORT)
+  //The file starts on a sector boundary, so every chunk but the last
+  //is whole, aligned sectors (or whole halves of one).
   uint8_t
-    this_chunk[CHUNK_SIZE];
+    this_chunk[EVE_LOAD_CHUNK_SIZE];
   do
     {
     //chunk loop
@@ -648,16 +1461,29 @@ void EVE_Load_File_To_RAM_G(uint32_t RAM_G_Address,
     //last transfer.
     uint16_t
       this_chunk_size;
-    if(bytes_remaining<CHUNK_SIZE)
+    if(bytes_remaining<EVE_LOAD_CHUNK_SIZE)
       {
       this_chunk_size=bytes_remaining;
       }
     else
       {
-      this_chunk_size=CHUNK_SIZE;
+      this_chunk_size=EVE_LOAD_CHUNK_SIZE;
       }
+#if (0 != EVE_LOAD_REPORT)
+    mark_us=micros();
+#endif // (0 != EVE_LOAD_REPORT)
     //Fill this_chunk from the uSD
-    binary_file.read(this_chunk,this_chunk_size);
+    if(this_chunk_size != binary_file.read(this_chunk,this_chunk_size))
+      {
+      DBG_STAT("  EVE_Load_File_To_RAM_G(): Read of \"%s\" failed.\n",File_Name);
+      binary_file.close();
+      EVE_RAM_G_Free(RAM_G_Start);
+      *RAM_G_Used=0;
+      return(EVE_RAM_G_NONE);
+      }
+#if (0 != EVE_LOAD_REPORT)
+    sd_us+=micros()-mark_us;
+#endif // (0 != EVE_LOAD_REPORT)
     //Keep track of bytes_remaining. This frees up this_chunk_size
     //so we can use it as a byte counter below.
     bytes_remaining-=this_chunk_size;
@@ -673,14 +1499,165 @@ void EVE_Load_File_To_RAM_G(uint32_t RAM_G_Address,
 
     //Pipe out this_chunk_size of data from this_chunk[]
     //to the EVE.
-    SPI.transfer(this_chunk,this_chunk_size);
+    EVE_SPI_Write_Burst(this_chunk,this_chunk_size);
 
     //De-select the EVE
-    SET_EVE_CS_NOT;
+    EVE_SPI_Deselect();
     } // chunk loop
   while(0 != bytes_remaining);
   //Release the BMP file handle
   binary_file.close();
+#if (0 != EVE_LOAD_REPORT)
+  uint32_t
+    total_us;
+  total_us=micros()-start_us;
+  //Bytes per ms is kB/s
+  DBG_STAT("  EVE_Load_File_To_RAM_G(): %lu bytes in %lu ms, %lu kB/s (uSD %lu ms, EVE %lu ms)\n",
+           *RAM_G_Used,
+           total_us/1000,
+           (*RAM_G_Used*1000)/(total_us|1),
+           sd_us/1000,
+           (total_us-sd_us)/1000);
+#endif // (0 != EVE_LOAD_REPORT)
+  return(RAM_G_Start);
+  }
+//---------------------------------------------------------------------------
+// Like EVE_Inflate_to_RAM_G(), but the zlib data comes off the uSD (see
+// uSD_Files/make_z.py). Each chunk is handed to the coprocessor as soon
+// as it is read, so the EVE inflates one chunk while the next one is
+// coming off the card.
+uint16_t EVE_Inflate_File_to_RAM_G(uint16_t FWol,
+                                   const char *File_Name,
+                                   uint32_t *RAM_G_Address,
+                                   uint32_t *RAM_G_Used)
+  {
+  uint32_t
+    RAM_G_End;
+  uint16_t
+    copro_resets;
+  DBG_GEEK("\n");
+  *RAM_G_Address=EVE_RAM_G_NONE;
+  *RAM_G_Used=0;
+  //The uSD shares the SPI bus, so make sure the EVE is not still
+  //selected from an open command burst.
+  EVE_Cmd_Burst_Close();
+  File
+    z_file;
+  z_file = SD.open(File_Name,FILE_READ);
+  if(0 == z_file)
+    {
+    DBG_STAT("  EVE_Inflate_File_to_RAM_G(): Can't open \"%s\".\n",File_Name);
+    return(FWol);
+    }
+  uint32_t
+    bytes_remaining;
+  bytes_remaining=z_file.size();
+  DBG_GEEK("  EVE_Inflate_File_to_RAM_G: found %s size: %lu\n",
+           z_file.name(),z_file.size());
+  //How big it is going to be is only known afterwards, so take all the
+  //room there is, and give back what is left over.
+  *RAM_G_Address=EVE_RAM_G_Alloc(EVE_RAM_G_Largest_Free(EVE_RAM_G_ALIGN_DL),
+                                 EVE_RAM_G_ALIGN_DL);
+  if(EVE_RAM_G_NONE == *RAM_G_Address)
+    {
+    z_file.close();
+    return(FWol);
+    }
+#if (0 != EVE_LOAD_REPORT)
+  uint32_t
+    start_us;
+  uint32_t
+    mark_us;
+  uint32_t
+    sd_us;
+  uint32_t
+    file_size;
+  start_us=micros();
+  sd_us=0;
+  file_size=bytes_remaining;
+#endif // (0 != EVE_LOAD_REPORT)
+  FWol=EVE_Cmd_Dat_1(FWol,
+                     EVE_ENC_CMD_INFLATE,
+                     *RAM_G_Address);
+  uint8_t
+    this_chunk[EVE_LOAD_CHUNK_SIZE];
+  while(0 != bytes_remaining)
+    {
+    uint16_t
+      this_chunk_size;
+    if(bytes_remaining<EVE_LOAD_CHUNK_SIZE)
+      {
+      this_chunk_size=bytes_remaining;
+      }
+    else
+      {
+      this_chunk_size=EVE_LOAD_CHUNK_SIZE;
+      }
+    //Get off the bus for the uSD.
+    EVE_Cmd_Burst_Close();
+#if (0 != EVE_LOAD_REPORT)
+    mark_us=micros();
+#endif // (0 != EVE_LOAD_REPORT)
+    if(this_chunk_size != z_file.read(this_chunk,this_chunk_size))
+      {
+      //The coprocessor is waiting for the rest of the stream, and there
+      //is no telling it otherwise, so start it over.
+      DBG_STAT("  EVE_Inflate_File_to_RAM_G(): Read of \"%s\" failed.\n",File_Name);
+      z_file.close();
+      EVE_RAM_G_Free(*RAM_G_Address);
+      *RAM_G_Address=EVE_RAM_G_NONE;
+      return(Reset_EVE_Coprocessor());
+      }
+#if (0 != EVE_LOAD_REPORT)
+    sd_us+=micros()-mark_us;
+#endif // (0 != EVE_LOAD_REPORT)
+    bytes_remaining-=this_chunk_size;
+    //The stream has to end on a 4-byte boundary. Only the last chunk
+    //can be short; the inflate stops at the end of the zlib data, so
+    //what the padding is does not matter.
+    while(0 != (this_chunk_size&0x03))
+      {
+      this_chunk[this_chunk_size]=0;
+      this_chunk_size++;
+      }
+    //The command writer waits for room in the ring.
+    FWol=EVE_Cmd_Stream(FWol,this_chunk,this_chunk_size);
+    //Let the EVE get started on it while we read the next chunk.
+    EVE_Cmd_Flush(FWol);
+    }
+  z_file.close();
+  //Now wait for the chip to finish with it.
+  EVE_Cmd_Flush(FWol);
+  copro_resets=EVE_Copro_Resets;
+  FWol=Wait_for_EVE_Execution_Complete(FWol);
+  if(copro_resets != EVE_Copro_Resets)
+    {
+    //Bad data (a corrupt file), the coprocessor faulted and was reset.
+    DBG_STAT("  EVE_Inflate_File_to_RAM_G(): INFLATE of \"%s\" faulted.\n",File_Name);
+    EVE_RAM_G_Free(*RAM_G_Address);
+    *RAM_G_Address=EVE_RAM_G_NONE;
+    return(FWol);
+    }
+
+  //Get the first free address in RAM_G from after the inflated data, and
+  //keep the block up to there.
+  FWol=Get_RAM_G_Pointer_After_INFLATE(FWol,
+                                       &RAM_G_End);
+  *RAM_G_Used=RAM_G_End-*RAM_G_Address;
+  EVE_RAM_G_Trim(*RAM_G_Address,*RAM_G_Used);
+#if (0 != EVE_LOAD_REPORT)
+  uint32_t
+    total_us;
+  total_us=micros()-start_us;
+  //Bytes per ms is kB/s, counted in what ends up in RAM_G
+  DBG_STAT("  EVE_Inflate_File_to_RAM_G(): %lu bytes from %lu in %lu ms, %lu kB/s (uSD %lu ms)\n",
+           *RAM_G_Used,
+           file_size,
+           total_us/1000,
+           (*RAM_G_Used*1000)/(total_us|1),
+           sd_us/1000);
+#endif // (0 != EVE_LOAD_REPORT)
+  return(FWol);
   }
 #endif
 //============================================================================
@@ -32,6 +32,57 @@
 //
 //For more information, please refer to <http://unlicense.org/>
 //============================================================================
+// Keep a shadow copy of the graphics state (color, alpha, line width,
+// point size, primitive and bitmap handle/source/layout/size) while a
+// display list is being built, and leave out the commands sent through
+// EVE_DL_Dat_0() that would not change it. END is left out too, except
+// for strips: the next BEGIN (or the end of the list) takes care of it.
+//
+// For this to work, every state command in a display list has to go
+// through EVE_DL_Dat_0(), including the CMD_DLSTART that starts the list.
+// After anything else that changes the state behind our back (the
+// coprocessor widgets, CMD_APPEND) call EVE_DL_State_Forget().
+#define EVE_DL_STATE_TRACKING (1)
+#if (0 != EVE_DL_STATE_TRACKING)
+// Number of commands left out. Counts up forever, the caller can zero it
+// whenever it likes (like at the start of each frame).
+extern uint16_t
+  EVE_DL_Elided;
+#endif // (0 != EVE_DL_STATE_TRACKING)
+uint16_t EVE_DL_Dat_0(uint16_t FWol,
+                      uint32_t command);
+void EVE_DL_State_Forget(void);
+//----------------------------------------------------------------------------
+// Send one vertex in the fewest bytes that will put it in the right place.
+// EVE_Vertex() takes whole pixels, EVE_Vertex_16() takes 1/16 pixels.
+//
+// With the state tracker on, a vertex on a whole pixel in 0..511 goes out
+// as a VERTEX2II. That needs the primitive (and for bitmaps the handle
+// and cell) to be known, and no VERTEX_TRANSLATE in effect. Otherwise it
+// is a VERTEX2F, and on FT81x and later the VERTEX_FORMAT is switched
+// only when the vertex does not fit the current one: whole pixels move to
+// format 0 (+/-16383 pixels, no *16 needed), 1/16 pixels to format 4, or
+// format 3 past the +/-1023 pixels that format 4 can reach. Without the
+// tracker, or on an FT80x, it is always a VERTEX2F in 1/16 pixels.
+//
+// Anything that sends its own VERTEX2F has to set the VERTEX_FORMAT it
+// expects through EVE_DL_Dat_0(), since the format may have been left at
+// anything.
+uint16_t EVE_Vertex(uint16_t FWol,
+                    int16_t x,
+                    int16_t y);
+uint16_t EVE_Vertex_16(uint16_t FWol,
+                       int16_t x,
+                       int16_t y);
+#if (FT810 <= EVE_DEVICE)
+// Move the origin for the vertices that follow, in 1/16 pixels. Handy
+// for drawing a widget in its own coordinates, or for keeping full 1/16
+// pixel precision on the far side of a panel wider than 1023 pixels.
+uint16_t EVE_Vertex_Translate(uint16_t FWol,
+                              int32_t x,
+                              int32_t y);
+#endif // (FT810 <= EVE_DEVICE)
+//----------------------------------------------------------------------------
 uint16_t EVE_Point(uint16_t FWol,
                    uint16_t point_x,
                    uint16_t point_y,
@@ -53,12 +104,52 @@ uint16_t EVE_Open_Rectangle(uint16_t FWol,
                             uint16_t x1,
                             uint16_t y1,
                             uint16_t width);
+//----------------------------------------------------------------------------
+// Many primitives of one kind at once: one BEGIN, then just the vertices,
+// with a color (or point size) change only where the arrays ask for one.
+// The VERTEX_FORMAT is picked once for the whole batch, and each vertex
+// is then a bare VERTEX2F, without the per-vertex work of EVE_Vertex().
+// The coordinates are x,y pairs, in the same units as the single
+// versions above: 1/16 pixel for points, pixels for lines and
+// rectangles. Lines and rectangles take two pairs each. colors (encoded
+// with EVE_ENC_COLOR_RGB) and sizes may be NULL to use the current color
+// and the size given. width is in pixels for both lines and rectangles,
+// for rectangles it rounds the corners, 1 keeps them sharp.
+uint16_t EVE_Points(uint16_t FWol,
+                    const int16_t *xy,
+                    uint16_t count,
+                    uint16_t point_size,
+                    const uint16_t *sizes,
+                    const uint32_t *colors);
+uint16_t EVE_Lines(uint16_t FWol,
+                   const int16_t *xy,
+                   uint16_t count,
+                   uint16_t width,
+                   const uint32_t *colors);
+uint16_t EVE_Rects(uint16_t FWol,
+                   const int16_t *xy,
+                   uint16_t count,
+                   uint16_t width,
+                   const uint32_t *colors);
+// Time drawing a lot of points with EVE_Point() against EVE_Points(), and
+// print the results on the debug console. Debug only.
+#define EVE_DRAW_BENCHMARK (0)
+#if (0 != EVE_DRAW_BENCHMARK)
+uint16_t EVE_Draw_Benchmark(uint16_t FWol);
+#endif // (0 != EVE_DRAW_BENCHMARK)
+//----------------------------------------------------------------------------
 uint16_t EVE_Text(uint16_t FWol,
                   uint16_t x,
                   uint16_t y,
                   uint16_t Font,
                   uint16_t Options,
                   char *message);   
+uint16_t EVE_TextF(uint16_t FWol,
+                   uint16_t x,
+                   uint16_t y,
+                   uint16_t Font,
+                   uint16_t Options,
+                   const __FlashStringHelper *message);
 // Don't call _EVE_PrintFF() directly, use EVE_PrintF() macro.
 uint16_t _EVE_PrintFF(uint16_t FWol,
                       uint16_t x,
@@ -67,6 +158,43 @@ uint16_t _EVE_PrintFF(uint16_t FWol,
                       uint16_t Options,
                       const __FlashStringHelper *fmt, ... );
 #define EVE_PrintF(FWol,x,y,Font,Options,fmt,...) _EVE_PrintFF(FWol,x,y,Font,Options,F(fmt),##__VA_ARGS__)
+//----------------------------------------------------------------------------
+// Numbers drawn by the coprocessor with CMD_NUMBER: 16 bytes each and
+// no formatting on the MCU, so these are the thing for values that change
+// every frame. Options are EVE_OPT_CENTERX, EVE_OPT_CENTERY,
+// EVE_OPT_CENTER or EVE_OPT_RIGHTX, plus:
+//   EVE_OPT_SIGNED     value is signed
+//   EVE_NUMBER_DIGITS(n)  pad with leading zeros to n digits (1 to 31)
+#define EVE_NUMBER_DIGITS(n) ((n)&0x1F)
+uint16_t EVE_Number(uint16_t FWol,
+                    uint16_t x,
+                    uint16_t y,
+                    uint16_t Font,
+                    uint16_t Options,
+                    int32_t value);
+#if (FT810 <= EVE_DEVICE)
+// The same, in base 2 to 36. Anything but 10 costs a CMD_SETBASE before
+// the number and another after it to put base 10 back.
+uint16_t EVE_Number_Base(uint16_t FWol,
+                         uint16_t x,
+                         uint16_t y,
+                         uint16_t Font,
+                         uint16_t Options,
+                         uint8_t base,
+                         int32_t value);
+#endif // (FT810 <= EVE_DEVICE)
+// A fixed-point decimal number, value having decimals (0 to 9) digits
+// after the point, so (1234,2) shows "12.34". CMD_NUMBER has no point, so
+// on BT81x this is a CMD_TEXT with EVE_OPT_FORMAT, the coprocessor still
+// doing the formatting. Earlier EVEs get EVE_PrintF(). Only the
+// positioning options apply.
+uint16_t EVE_Number_Fixed(uint16_t FWol,
+                          uint16_t x,
+                          uint16_t y,
+                          uint16_t Font,
+                          uint16_t Options,
+                          int32_t value,
+                          uint8_t decimals);
                                        
 uint16_t Start_Busy_Spinner_Screen(uint16_t FWol,
                                    uint32_t Clear_Color,
@@ -78,6 +206,8 @@ uint16_t Stop_Busy_Spinner_Screen(uint16_t FWol,
                                   uint32_t Text_Color,
                                   const __FlashStringHelper *message);
 uint16_t Calibrate_Touch(uint16_t FWol);
+// The loaders below get their RAM_G from EVE_RAM_G_Alloc() (EVE_ram_g.h),
+// and pass back where it is, EVE_RAM_G_NONE if there was no room.
 uint16_t EVE_Load_PNG_to_RAM_G(uint16_t FWol,
                                const uint8_t *PNG_data,
                                uint32_t PNG_length,
@@ -88,8 +218,107 @@ uint16_t EVE_Inflate_to_RAM_G(uint16_t FWol,
                               const uint8_t *Flash_Data,
                               uint32_t data_length,
                               uint32_t *RAM_G_Address);
-void EVE_Load_File_To_RAM_G(uint32_t RAM_G_Address,
-                            const char *File_Name,
-                            uint32_t *RAM_G_Used);
+uint32_t EVE_Load_File_To_RAM_G(const char *File_Name,
+                                uint8_t alignment,
+                                uint32_t *RAM_G_Used);
+uint16_t EVE_Inflate_File_to_RAM_G(uint16_t FWol,
+                                   const char *File_Name,
+                                   uint32_t *RAM_G_Address,
+                                   uint32_t *RAM_G_Used);
+// EVE_Load_File_To_RAM_G() and EVE_Inflate_File_to_RAM_G() each move
+// the file through their own buffer of this size on the stack. Neither
+// calls the other, so only one is ever there at a time. The uSD and the
+// EVE share the SPI bus, so the read and the write take turns. When a
+// read is a whole 512-byte sector, the SD library puts it straight into
+// the buffer instead of into its sector cache and copying it out, so 512
+// is quicker. It is also 512 bytes of stack out of the ATmega328's 2K, on
+// top of the SD library and the demo's load function that called it, so
+// 256 it is unless there is room to spare.
+#define EVE_LOAD_CHUNK_SIZE (256)
+#if ((0 != (512 % EVE_LOAD_CHUNK_SIZE)) && (0 != (EVE_LOAD_CHUNK_SIZE % 512)))
+#error EVE_LOAD_CHUNK_SIZE must divide into, or be a multiple of, the 512-byte uSD sector
+#endif
+//============================================================================
+// A piece of display list that is built once by the coprocessor, copied
+// from RAM_DL into RAM_G, and then put into each frame with CMD_APPEND.
+//
+//   EVE_DL_Cache_Initialize(&cache,size)
+//   ...
+//   if(EVE_DL_Cache_Needs_Record(&cache))
+//     {
+//     FWol=EVE_DL_Cache_Record_Start(FWol);
+//     ... the display list commands to keep ...
+//     FWol=EVE_DL_Cache_Record_End(FWol,&cache);
+//     }
+//   FWol=EVE_Cmd_Dat_0(FWol,EVE_ENC_CMD_DLSTART);
+//   FWol=EVE_DL_Cache_Append(FWol,&cache);
+//
+// Record outside of a frame, it uses (and clears) the display list being
+// built. Call EVE_DL_Cache_Invalidate() when anything in the cached
+// commands has to change; it will be recorded again the next time round.
+// The RAM_G comes from EVE_RAM_G_Alloc(). If there is none, the cache
+// never records and EVE_DL_Cache_Append() does nothing. If a recording
+// does not fit, EVE_DL_Cache_Record_End() gives the RAM_G back and the
+// cache never records again. EVE_DL_Cache_Release() gives it back.
+typedef struct
+  {
+  // Where the recording lives in RAM_G, EVE_RAM_G_NONE if it has none
+  uint32_t RAM_G_Address;
+  // Bytes reserved there, 0 if caching has been given up on
+  uint16_t capacity;
+  // Bytes recorded, 0 if there is nothing valid to append
+  uint16_t length;
+  } EVE_DL_Cache;
+void EVE_DL_Cache_Initialize(EVE_DL_Cache *cache,
+                             uint16_t capacity);
+void EVE_DL_Cache_Release(EVE_DL_Cache *cache);
+uint16_t EVE_DL_Cache_Record_Start(uint16_t FWol);
+uint16_t EVE_DL_Cache_Record_End(uint16_t FWol,
+                                 EVE_DL_Cache *cache);
+uint16_t EVE_DL_Cache_Append(uint16_t FWol,
+                             EVE_DL_Cache *cache);
+#define EVE_DL_Cache_Invalidate(cache)   ((cache)->length=0)
+#define EVE_DL_Cache_Is_Valid(cache)     (0 != (cache)->length)
+#define EVE_DL_Cache_Needs_Record(cache) ((0 == (cache)->length) && \
+                                          (0 != (cache)->capacity))
+//============================================================================
+// Bitmap handles that stay bound to the same image. Each image is
+// registered once, after it is loaded, and gets a handle of its own.
+// EVE_Bitmap_Prologue() puts the BITMAP_SOURCE/LAYOUT/SIZE for all of
+// them into the display list; it belongs in the static part of the frame
+// (see EVE_DL_Cache above) so it costs one CMD_APPEND per frame instead
+// of three or more commands per image. After that a draw only has to say
+// which handle, and EVE_Bitmap_Draw() can often do the whole image in a
+// single VERTEX2II.
+//
+// Handle 0 is left alone for ad-hoc use, the registry hands out 1 and up.
+// Each one costs 12 bytes of RAM.
+#define EVE_BITMAP_HANDLES (3)
+#if (15 <= EVE_BITMAP_HANDLES)
+#error EVE_BITMAP_HANDLES: 15 is used by the coprocessor, 16 and up are fonts.
+#endif
+// Give handle 0 to get a new one, or one you already have to point it at
+// a new image. Returns the handle, 0 if they are all taken. Anything
+// holding a copy of the prologue (a EVE_DL_Cache) has to be invalidated.
+uint8_t EVE_Bitmap_Register(uint8_t handle,
+                            uint32_t source,
+                            uint8_t format,
+                            uint16_t stride,
+                            uint16_t width,
+                            uint16_t height,
+                            uint8_t filter);
+uint16_t EVE_Bitmap_Prologue(uint16_t FWol);
+// Draw a registered image with its top left corner at x,y in pixels,
+// using the current color, alpha and cell.
+uint16_t EVE_Bitmap_Draw(uint16_t FWol,
+                         uint8_t handle,
+                         int16_t x,
+                         int16_t y);
+// Put a transform worked out with the EVE_Matrix calls (EVE_math.h) into
+// the display list as BITMAP_TRANSFORM_A..F. Six words, fewer with the
+// state tracker when parts of it are unchanged, and no work for the
+// coprocessor. Send an identity matrix to put things back afterwards.
+uint16_t EVE_Bitmap_Transform(uint16_t FWol,
+                              const EVE_Matrix *m);
 //============================================================================
 #endif // __EVE_DRAW_H__
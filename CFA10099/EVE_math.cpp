@@ -0,0 +1,446 @@
+//============================================================================
+//
+// Fixed-point math for working out EVE drawing on the MCU.
+//
+// Crystalfontz America, Inc.
+// https://www.crystalfontz.com/products/eve-accelerated-tft-displays.php
+//===========================================================================
+//This is free and unencumbered software released into the public domain.
+//
+//Anyone is free to copy, modify, publish, use, compile, sell, or
+//distribute this software, either in source code form or as a compiled
+//binary, for any purpose, commercial or non-commercial, and by any
+//means.
+//
+//In jurisdictions that recognize copyright laws, the author or authors
+//of this software dedicate any and all copyright interest in the
+//software to the public domain. We make this dedication for the benefit
+//of the public at large and to the detriment of our heirs and
+//successors. We intend this dedication to be an overt act of
+//relinquishment in perpetuity of all present and future rights to this
+//software under copyright law.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+//EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+//OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+//ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+//OTHER DEALINGS IN THE SOFTWARE.
+//
+//For more information, please refer to <http://unlicense.org/>
+//============================================================================
+#include <Arduino.h>
+#include <SPI.h>
+#include <math.h>
+
+// Definitions for our display.
+#include "CFA10099_defines.h"
+
+#include "EVE_defines.h"
+#include "EVE_spi.h"
+#include "EVE_base.h"
+#include "EVE_math.h"
+//===========================================================================
+// sin() of 0 to 90 degrees in 64 steps, Q1.15
+static const int16_t EVE_Sine_Table[65] PROGMEM =
+  {
+      0,  804, 1608, 2411, 3212, 4011, 4808, 5602,
+   6393, 7180, 7962, 8740, 9512,10279,11039,11793,
+  12540,13279,14010,14733,15447,16151,16846,17531,
+  18205,18868,19520,20160,20788,21403,22006,22595,
+  23170,23732,24279,24812,25330,25833,26320,26791,
+  27246,27684,28106,28511,28899,29269,29622,29957,
+  30274,30572,30853,31114,31357,31581,31786,31972,
+  32138,32286,32413,32522,32610,32679,32729,32758,
+  32767
+  };
+//---------------------------------------------------------------------------
+int16_t EVE_Sin_Q15(uint16_t angle)
+  {
+  uint16_t
+    quarter;
+  uint8_t
+    index;
+  uint8_t
+    frac;
+  int16_t
+    value;
+  //Fold the second and fourth quarters back onto the first and third.
+  quarter=angle & 0x3FFF;
+  if(0 != (angle & 0x4000))
+    {
+    quarter=0x4000-quarter;
+    }
+  index=quarter>>8;
+  frac=quarter & 0xFF;
+  value=(int16_t)pgm_read_word(&EVE_Sine_Table[index]);
+  if(0 != frac)
+    {
+    //Straight line to the next entry
+    value+=(int16_t)(((int32_t)((int16_t)pgm_read_word(&EVE_Sine_Table[index+1])-value)*frac)>>8);
+    }
+  //The second half of the circle is the first upside down.
+  if(0 != (angle & 0x8000))
+    {
+    value=-value;
+    }
+  return(value);
+  }
+//---------------------------------------------------------------------------
+int16_t EVE_Cos_Q15(uint16_t angle)
+  {
+  return(EVE_Sin_Q15(angle+0x4000));
+  }
+//===========================================================================
+// The matrix is kept as the inverse of the transform the calls describe,
+// since that is what the EVE wants. Applying a transform X after the ones
+// so far (M*X) then means putting X's inverse in front: inv(X)*inv(M).
+//
+// 16.16 times Q1.15, back to 16.16
+static int32_t _EVE_Mul_Q15(int32_t x, int16_t q)
+  {
+  return((int32_t)(((int64_t)x*q)>>15));
+  }
+//---------------------------------------------------------------------------
+void EVE_Matrix_Identity(EVE_Matrix *m)
+  {
+  m->a=0x10000;
+  m->b=0;
+  m->c=0;
+  m->d=0;
+  m->e=0x10000;
+  m->f=0;
+  }
+//---------------------------------------------------------------------------
+void EVE_Matrix_Translate(EVE_Matrix *m,
+                          int32_t x,
+                          int32_t y)
+  {
+  m->c-=x;
+  m->f-=y;
+  }
+//---------------------------------------------------------------------------
+void EVE_Matrix_Rotate(EVE_Matrix *m,
+                       uint16_t angle)
+  {
+  int16_t
+    sine;
+  int16_t
+    cosine;
+  int32_t
+    row_1;
+  if(0 == angle)
+    {
+    //cos(0) in Q1.15 is a hair under 1, so do not let it shrink anything.
+    return;
+    }
+  sine=EVE_Sin_Q15(angle);
+  cosine=EVE_Cos_Q15(angle);
+  //The inverse of a clockwise rotation:
+  //  | cos  sin |
+  //  |-sin  cos |
+  row_1   =_EVE_Mul_Q15(m->a,cosine)+_EVE_Mul_Q15(m->d,sine);
+  m->d    =_EVE_Mul_Q15(m->d,cosine)-_EVE_Mul_Q15(m->a,sine);
+  m->a    =row_1;
+  row_1   =_EVE_Mul_Q15(m->b,cosine)+_EVE_Mul_Q15(m->e,sine);
+  m->e    =_EVE_Mul_Q15(m->e,cosine)-_EVE_Mul_Q15(m->b,sine);
+  m->b    =row_1;
+  row_1   =_EVE_Mul_Q15(m->c,cosine)+_EVE_Mul_Q15(m->f,sine);
+  m->f    =_EVE_Mul_Q15(m->f,cosine)-_EVE_Mul_Q15(m->c,sine);
+  m->c    =row_1;
+  }
+//---------------------------------------------------------------------------
+void EVE_Matrix_Scale(EVE_Matrix *m,
+                      int32_t x,
+                      int32_t y)
+  {
+  //Dividing by the scale is the inverse.
+  m->a=(int32_t)(((int64_t)m->a<<16)/x);
+  m->b=(int32_t)(((int64_t)m->b<<16)/x);
+  m->c=(int32_t)(((int64_t)m->c<<16)/x);
+  m->d=(int32_t)(((int64_t)m->d<<16)/y);
+  m->e=(int32_t)(((int64_t)m->e<<16)/y);
+  m->f=(int32_t)(((int64_t)m->f<<16)/y);
+  }
+//===========================================================================
+// atan() of 0 to 1 in 32 steps, in 1/65536 of a circle
+static const uint16_t EVE_Atan_Table[33] PROGMEM =
+  {
+      0,  326,  651,  975, 1297, 1617, 1933, 2246,
+   2555, 2860, 3159, 3453, 3742, 4025, 4302, 4572,
+   4836, 5094, 5344, 5589, 5826, 6058, 6282, 6500,
+   6712, 6917, 7117, 7310, 7498, 7679, 7856, 8026,
+   8192
+  };
+//---------------------------------------------------------------------------
+// ratio is 0 to 32768 for 0 to 1
+static uint16_t _EVE_Atan_Ratio(uint16_t ratio)
+  {
+  uint8_t
+    index;
+  uint16_t
+    frac;
+  uint16_t
+    value;
+  index=ratio>>10;
+  frac=ratio & 0x3FF;
+  value=pgm_read_word(&EVE_Atan_Table[index]);
+  if(0 != frac)
+    {
+    value+=(uint16_t)(((uint32_t)(pgm_read_word(&EVE_Atan_Table[index+1])-value)*frac)>>10);
+    }
+  return(value);
+  }
+//---------------------------------------------------------------------------
+uint16_t EVE_Atan2(int16_t y,
+                   int16_t x)
+  {
+  uint16_t
+    ax;
+  uint16_t
+    ay;
+  uint16_t
+    angle;
+  ax=(x < 0)?(uint16_t)-x:(uint16_t)x;
+  ay=(y < 0)?(uint16_t)-y:(uint16_t)y;
+  if((0 == ax)&&(0 == ay))
+    {
+    return(0);
+    }
+  //Work it out in the first octant, then unfold it.
+  if(ay <= ax)
+    {
+    angle=_EVE_Atan_Ratio((uint16_t)(((uint32_t)ay<<15)/ax));
+    }
+  else
+    {
+    angle=0x4000-_EVE_Atan_Ratio((uint16_t)(((uint32_t)ax<<15)/ay));
+    }
+  if(x < 0)
+    {
+    angle=0x8000-angle;
+    }
+  if(y < 0)
+    {
+    angle=-angle;
+    }
+  return(angle);
+  }
+//---------------------------------------------------------------------------
+uint16_t EVE_Sqrt(uint32_t value)
+  {
+  uint32_t
+    root;
+  uint32_t
+    bit;
+  //One result bit per pass, from the top down.
+  root=0;
+  bit=1UL<<30;
+  while(value < bit)
+    {
+    bit>>=2;
+    }
+  while(0 != bit)
+    {
+    if(root+bit <= value)
+      {
+      value-=root+bit;
+      root=(root>>1)+bit;
+      }
+    else
+      {
+      root>>=1;
+      }
+    bit>>=2;
+    }
+  return((uint16_t)root);
+  }
+//===========================================================================
+// The squares are t*(t+1) rather than t*t, so that 65535 comes out as
+// 65535 and not 65534: every curve starts at exactly 0 and ends at
+// exactly 65535.
+uint16_t EVE_Ease(uint8_t curve,
+                  uint16_t t)
+  {
+  uint16_t
+    value;
+  switch(curve)
+    {
+    case EVE_EASE_IN:
+      return((uint16_t)(((uint32_t)t*(t+1UL))>>16));
+    case EVE_EASE_OUT:
+      t=0xFFFF-t;
+      return(0xFFFF-(uint16_t)(((uint32_t)t*(t+1UL))>>16));
+    case EVE_EASE_IN_OUT:
+      if(t < 0x8000)
+        {
+        return((uint16_t)(((uint32_t)t*(t+1UL))>>15));
+        }
+      t=0xFFFF-t;
+      return(0xFFFF-(uint16_t)(((uint32_t)t*(t+1UL))>>15));
+    case EVE_EASE_SINE:
+      //(1-cos(t*pi))/2, t*pi being t/2 of a circle. That runs 0 to 65534,
+      //so stretch the top half by one.
+      value=(uint16_t)(0x7FFF-EVE_Cos_Q15((uint16_t)((t+1UL)>>1)));
+      return(value+(value>>15));
+    default:
+      return(t);
+    }
+  }
+//---------------------------------------------------------------------------
+void EVE_Animation_Start(EVE_Animation *animation,
+                         int32_t from,
+                         int32_t to,
+                         uint16_t frames,
+                         uint8_t curve)
+  {
+  animation->from=from;
+  animation->to=to;
+  animation->frames=frames;
+  animation->frame=0;
+  animation->curve=curve;
+  }
+//---------------------------------------------------------------------------
+int32_t EVE_Animation_Step(EVE_Animation *animation)
+  {
+  uint16_t
+    t;
+  if(animation->frames <= animation->frame)
+    {
+    return(animation->to);
+    }
+  animation->frame++;
+  if(animation->frames == animation->frame)
+    {
+    return(animation->to);
+    }
+  t=(uint16_t)(((uint32_t)animation->frame<<16)/animation->frames);
+  //to-from can take 33 bits.
+  return(animation->from+
+         (int32_t)((((int64_t)animation->to-animation->from)*
+                    EVE_Ease(animation->curve,t))>>16));
+  }
+//===========================================================================
+#if (0 != EVE_MATH_BENCHMARK)
+// Keeps the timing loops from being optimized away
+static volatile int32_t
+  EVE_Math_Benchmark_Sink;
+#define EVE_MATH_BENCHMARK_CALLS (1000)
+//---------------------------------------------------------------------------
+void EVE_Math_Benchmark(void)
+  {
+  uint32_t
+    i;
+  int16_t
+    x;
+  int16_t
+    y;
+  int32_t
+    error;
+  int32_t
+    worst;
+  uint32_t
+    start_us;
+  uint32_t
+    table_us;
+  DBG_STAT("Fixed-point math against float:\n");
+
+  //Accuracy
+  worst=0;
+  for(i=0;i<65536;i+=7)
+    {
+    error=EVE_Sin_Q15((uint16_t)i)-lround(sin(i*(2*M_PI/65536))*32767.0);
+    if(error < 0)
+      {
+      error=-error;
+      }
+    if(worst < error)
+      {
+      worst=error;
+      }
+    }
+  DBG_STAT("  EVE_Sin_Q15(): worst error %ld/32767\n",worst);
+  worst=0;
+  for(x=-1000;x<=1000;x+=37)
+    {
+    for(y=-1000;y<=1000;y+=41)
+      {
+      //Compare the angles modulo a full circle.
+      error=(int16_t)(EVE_Atan2(y,x)-
+                      (uint16_t)lround(atan2(y,x)*(65536/(2*M_PI))));
+      if(error < 0)
+        {
+        error=-error;
+        }
+      if(worst < error)
+        {
+        worst=error;
+        }
+      }
+    }
+  DBG_STAT("  EVE_Atan2():   worst error %ld/65536 of a circle\n",worst);
+  worst=0;
+  i=0;
+  while(1)
+    {
+    if((uint32_t)EVE_Sqrt(i) != (uint32_t)sqrt((double)i))
+      {
+      worst++;
+      }
+    if((0xFFFFFFFFUL-1)/3 < i)
+      {
+      //The next step would wrap past 2^32.
+      break;
+      }
+    i=i*3+1;
+    }
+  if(0xFFFF != EVE_Sqrt(0xFFFFFFFFUL))
+    {
+    worst++;
+    }
+  DBG_STAT("  EVE_Sqrt():    %ld wrong\n",worst);
+
+  //Speed, us per EVE_MATH_BENCHMARK_CALLS calls
+  start_us=micros();
+  for(i=0;i<EVE_MATH_BENCHMARK_CALLS;i++)
+    {
+    EVE_Math_Benchmark_Sink=EVE_Sin_Q15((uint16_t)(i*97));
+    }
+  table_us=(uint32_t)(micros()-start_us);
+  start_us=micros();
+  for(i=0;i<EVE_MATH_BENCHMARK_CALLS;i++)
+    {
+    EVE_Math_Benchmark_Sink=(int32_t)(sin((float)i*0.0093f)*32767.0f);
+    }
+  DBG_STAT("  sin:   %lu us table, %lu us float, per %u calls\n",
+           table_us,(uint32_t)(micros()-start_us),EVE_MATH_BENCHMARK_CALLS);
+  start_us=micros();
+  for(i=0;i<EVE_MATH_BENCHMARK_CALLS;i++)
+    {
+    EVE_Math_Benchmark_Sink=EVE_Atan2((int16_t)(i*13),(int16_t)(500-i));
+    }
+  table_us=(uint32_t)(micros()-start_us);
+  start_us=micros();
+  for(i=0;i<EVE_MATH_BENCHMARK_CALLS;i++)
+    {
+    EVE_Math_Benchmark_Sink=(int32_t)(atan2((float)(i*13),(float)(500-(int32_t)i))*10430.378f);
+    }
+  DBG_STAT("  atan2: %lu us table, %lu us float, per %u calls\n",
+           table_us,(uint32_t)(micros()-start_us),EVE_MATH_BENCHMARK_CALLS);
+  start_us=micros();
+  for(i=0;i<EVE_MATH_BENCHMARK_CALLS;i++)
+    {
+    EVE_Math_Benchmark_Sink=EVE_Sqrt(i*40503UL);
+    }
+  table_us=(uint32_t)(micros()-start_us);
+  start_us=micros();
+  for(i=0;i<EVE_MATH_BENCHMARK_CALLS;i++)
+    {
+    EVE_Math_Benchmark_Sink=(int32_t)sqrt((float)(i*40503UL));
+    }
+  DBG_STAT("  sqrt:  %lu us integer, %lu us float, per %u calls\n",
+           table_us,(uint32_t)(micros()-start_us),EVE_MATH_BENCHMARK_CALLS);
+  }
+#endif // (0 != EVE_MATH_BENCHMARK)
+//===========================================================================
@@ -0,0 +1,134 @@
+#ifndef __EVE_MATH_H__
+#define __EVE_MATH_H__
+//============================================================================
+//
+// Fixed-point math for working out EVE drawing on the MCU, without
+// pulling floating point into an ATmega328P.
+//
+// Angles are in 1/65536 of a circle, clockwise, the same units as
+// CMD_ROTATE. EVE_DEGREES() converts from whole degrees.
+//
+// Crystalfontz America, Inc.
+// https://www.crystalfontz.com/products/eve-accelerated-tft-displays.php
+//===========================================================================
+//This is free and unencumbered software released into the public domain.
+//
+//Anyone is free to copy, modify, publish, use, compile, sell, or
+//distribute this software, either in source code form or as a compiled
+//binary, for any purpose, commercial or non-commercial, and by any
+//means.
+//
+//In jurisdictions that recognize copyright laws, the author or authors
+//of this software dedicate any and all copyright interest in the
+//software to the public domain. We make this dedication for the benefit
+//of the public at large and to the detriment of our heirs and
+//successors. We intend this dedication to be an overt act of
+//relinquishment in perpetuity of all present and future rights to this
+//software under copyright law.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+//EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+//OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+//ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+//OTHER DEALINGS IN THE SOFTWARE.
+//
+//For more information, please refer to <http://unlicense.org/>
+//============================================================================
+#define EVE_DEGREES(degrees) ((uint16_t)(((int32_t)(degrees)*65536L)/360))
+// Sine and cosine in Q1.15 (32767 is 1.0), from a quarter wave table in
+// flash with linear interpolation between its 64 steps. Good to 3 units.
+int16_t EVE_Sin_Q15(uint16_t angle);
+int16_t EVE_Cos_Q15(uint16_t angle);
+//============================================================================
+// A 2D affine transform, kept the way the BITMAP_TRANSFORM_A..F commands
+// want it: from screen pixels (relative to the vertex) back to bitmap
+// pixels.
+//
+//   u = a*x + b*y + c
+//   v = d*x + e*y + f
+//
+// Everything is 16.16 fixed point. The calls work like the coprocessor
+// commands they are named after: start with EVE_Matrix_Identity(), then
+// apply them in the same order as CMD_TRANSLATE, CMD_ROTATE and
+// CMD_SCALE would be. EVE_Bitmap_Transform() in EVE_draw puts the result
+// into the display list, where CMD_SETMATRIX would.
+typedef struct
+  {
+  int32_t a;
+  int32_t b;
+  int32_t c;
+  int32_t d;
+  int32_t e;
+  int32_t f;
+  } EVE_Matrix;
+void EVE_Matrix_Identity(EVE_Matrix *m);
+void EVE_Matrix_Translate(EVE_Matrix *m,
+                          int32_t x,
+                          int32_t y);
+void EVE_Matrix_Rotate(EVE_Matrix *m,
+                       uint16_t angle);
+// Scale factors are 16.16, and must not be 0.
+void EVE_Matrix_Scale(EVE_Matrix *m,
+                      int32_t x,
+                      int32_t y);
+//============================================================================
+// The angle from the origin to x,y, so that x,y is a multiple of
+// EVE_Cos_Q15(angle),EVE_Sin_Q15(angle). From a 33-entry table, good to
+// two units (0.011 degrees). 0 for 0,0.
+uint16_t EVE_Atan2(int16_t y,
+                   int16_t x);
+// Integer square root, rounded down. Exact, no table needed.
+uint16_t EVE_Sqrt(uint32_t value);
+//============================================================================
+// Easing curves. t runs from 0 to 65535 (just short of 1.0 in Q0.16), and
+// so does the result: 0 gives exactly 0, and 65535 exactly 65535.
+#define EVE_EASE_LINEAR (0)
+// Quadratic, starting slow
+#define EVE_EASE_IN     (1)
+// Quadratic, ending slow
+#define EVE_EASE_OUT    (2)
+// Quadratic, slow at both ends
+#define EVE_EASE_IN_OUT (3)
+// Half a cosine wave, the gentlest start and stop
+#define EVE_EASE_SINE   (4)
+uint16_t EVE_Ease(uint8_t curve,
+                  uint16_t t);
+//----------------------------------------------------------------------------
+// A value that moves from one number to another over a number of frames,
+// along one of the easing curves.
+//
+//   EVE_Animation_Start(&spin,0,65536,360,EVE_EASE_SINE);
+//   ...once per frame:
+//   if(!EVE_Animation_Done(&spin))
+//     angle=EVE_Animation_Step(&spin);
+typedef struct
+  {
+  int32_t from;
+  int32_t to;
+  uint16_t frames;
+  uint16_t frame;
+  uint8_t curve;
+  } EVE_Animation;
+void EVE_Animation_Start(EVE_Animation *animation,
+                         int32_t from,
+                         int32_t to,
+                         uint16_t frames,
+                         uint8_t curve);
+// Move on one frame and return the value there. The last step returns
+// exactly to, and so does every step after that.
+int32_t EVE_Animation_Step(EVE_Animation *animation);
+#define EVE_Animation_Done(animation) ((animation)->frames <= (animation)->frame)
+//============================================================================
+// Check the tables against the floating point library and time both, and
+// print the results on the debug console from setup(). Debug only.
+// (host/Makefile turns it on for math_test, which also checks the bounds.)
+#if !defined(EVE_MATH_BENCHMARK)
+#define EVE_MATH_BENCHMARK (0)
+#endif // !defined(EVE_MATH_BENCHMARK)
+#if (0 != EVE_MATH_BENCHMARK)
+void EVE_Math_Benchmark(void);
+#endif // (0 != EVE_MATH_BENCHMARK)
+//============================================================================
+#endif // __EVE_MATH_H__
@@ -0,0 +1,317 @@
+//============================================================================
+//
+// RAM_G allocator for FTDI / BridgeTek EVE graphic accelerators.
+//
+// Crystalfontz America, Inc.
+// https://www.crystalfontz.com/products/eve-accelerated-tft-displays.php
+//===========================================================================
+//This is free and unencumbered software released into the public domain.
+//
+//Anyone is free to copy, modify, publish, use, compile, sell, or
+//distribute this software, either in source code form or as a compiled
+//binary, for any purpose, commercial or non-commercial, and by any
+//means.
+//
+//In jurisdictions that recognize copyright laws, the author or authors
+//of this software dedicate any and all copyright interest in the
+//software to the public domain. We make this dedication for the benefit
+//of the public at large and to the detriment of our heirs and
+//successors. We intend this dedication to be an overt act of
+//relinquishment in perpetuity of all present and future rights to this
+//software under copyright law.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+//EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+//OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+//ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+//OTHER DEALINGS IN THE SOFTWARE.
+//
+//For more information, please refer to <http://unlicense.org/>
+//============================================================================
+#include <Arduino.h>
+#include <SPI.h>
+
+// Definitions for our display.
+#include "CFA10099_defines.h"
+
+#include "EVE_defines.h"
+#include "EVE_spi.h"
+#include "EVE_base.h"
+#include "EVE_ram_g.h"
+//============================================================================
+// The blocks in use, in order of address.
+static struct
+  {
+  uint32_t address;
+  uint32_t length;
+  } EVE_RAM_G_Block[EVE_RAM_G_BLOCKS];
+static uint8_t
+  EVE_RAM_G_Blocks;
+//----------------------------------------------------------------------------
+// Gap n is the free space in front of block n. Gap EVE_RAM_G_Blocks runs
+// to the end of RAM_G.
+static uint32_t _EVE_RAM_G_Gap_Start(uint8_t gap)
+  {
+  if(0 == gap)
+    {
+    return(EVE_RAM_G);
+    }
+  return(EVE_RAM_G_Block[gap-1].address+EVE_RAM_G_Block[gap-1].length);
+  }
+//----------------------------------------------------------------------------
+static uint32_t _EVE_RAM_G_Gap_End(uint8_t gap)
+  {
+  if(EVE_RAM_G_Blocks == gap)
+    {
+    return(EVE_RAM_G+EVE_RAM_G_SIZE);
+    }
+  return(EVE_RAM_G_Block[gap].address);
+  }
+//----------------------------------------------------------------------------
+// Room in a gap once its start is aligned, 0 if none.
+static uint32_t _EVE_RAM_G_Gap_Room(uint8_t gap,
+                                    uint8_t alignment,
+                                    uint32_t *start)
+  {
+  uint32_t
+    end;
+  *start=(_EVE_RAM_G_Gap_Start(gap)+(alignment-1))&~(uint32_t)(alignment-1);
+  end=_EVE_RAM_G_Gap_End(gap);
+  if(end <= *start)
+    {
+    return(0);
+    }
+  return(end-*start);
+  }
+//----------------------------------------------------------------------------
+static uint8_t _EVE_RAM_G_Find(uint32_t address)
+  {
+  uint8_t
+    i;
+  for(i=0;i<EVE_RAM_G_Blocks;i++)
+    {
+    if(address == EVE_RAM_G_Block[i].address)
+      {
+      break;
+      }
+    }
+  if(EVE_RAM_G_Blocks == i)
+    {
+    DBG_STAT("EVE_RAM_G: 0x%08lX is not an allocated block.\n",address);
+    }
+  return(i);
+  }
+//============================================================================
+void EVE_RAM_G_Reset(void)
+  {
+  EVE_RAM_G_Blocks=0;
+  }
+//----------------------------------------------------------------------------
+uint32_t EVE_RAM_G_Alloc(uint32_t length,
+                         uint8_t alignment)
+  {
+  uint8_t
+    gap;
+  uint32_t
+    start;
+  if(0 == length)
+    {
+    //Nothing to hold, and two blocks must never share an address.
+    DBG_STAT("EVE_RAM_G_Alloc(): asked for 0 bytes.\n");
+    return(EVE_RAM_G_NONE);
+    }
+  if(EVE_RAM_G_BLOCKS == EVE_RAM_G_Blocks)
+    {
+    DBG_STAT("EVE_RAM_G_Alloc(): all %u blocks in use.\n",EVE_RAM_G_BLOCKS);
+    return(EVE_RAM_G_NONE);
+    }
+  length=(length+0x03)&0xFFFFFFFC;
+  for(gap=0;gap<=EVE_RAM_G_Blocks;gap++)
+    {
+    if(length <= _EVE_RAM_G_Gap_Room(gap,alignment,&start))
+      {
+      //Make room for it in the table, in front of the block after the gap.
+      memmove(&EVE_RAM_G_Block[gap+1],
+              &EVE_RAM_G_Block[gap],
+              (EVE_RAM_G_Blocks-gap)*sizeof(EVE_RAM_G_Block[0]));
+      EVE_RAM_G_Block[gap].address=start;
+      EVE_RAM_G_Block[gap].length=length;
+      EVE_RAM_G_Blocks++;
+      return(start);
+      }
+    }
+  DBG_STAT("EVE_RAM_G_Alloc(): no room for %lu bytes, %lu is the most.\n",
+           length,EVE_RAM_G_Largest_Free(alignment));
+  return(EVE_RAM_G_NONE);
+  }
+//----------------------------------------------------------------------------
+void EVE_RAM_G_Free(uint32_t address)
+  {
+  uint8_t
+    i;
+  i=_EVE_RAM_G_Find(address);
+  if(EVE_RAM_G_Blocks == i)
+    {
+    return;
+    }
+  EVE_RAM_G_Blocks--;
+  memmove(&EVE_RAM_G_Block[i],
+          &EVE_RAM_G_Block[i+1],
+          (EVE_RAM_G_Blocks-i)*sizeof(EVE_RAM_G_Block[0]));
+  }
+//----------------------------------------------------------------------------
+void EVE_RAM_G_Trim(uint32_t address,
+                    uint32_t length)
+  {
+  uint8_t
+    i;
+  i=_EVE_RAM_G_Find(address);
+  if(EVE_RAM_G_Blocks == i)
+    {
+    return;
+    }
+  //Keep at least a word, so no two blocks ever start at the same address.
+  length=(length+0x03)&0xFFFFFFFC;
+  if(0 == length)
+    {
+    length=4;
+    }
+  if(length < EVE_RAM_G_Block[i].length)
+    {
+    EVE_RAM_G_Block[i].length=length;
+    }
+  }
+//----------------------------------------------------------------------------
+uint32_t EVE_RAM_G_Largest_Free(uint8_t alignment)
+  {
+  uint8_t
+    gap;
+  uint32_t
+    start;
+  uint32_t
+    room;
+  uint32_t
+    largest;
+  largest=0;
+  for(gap=0;gap<=EVE_RAM_G_Blocks;gap++)
+    {
+    room=_EVE_RAM_G_Gap_Room(gap,alignment,&start);
+    if(largest < room)
+      {
+      largest=room;
+      }
+    }
+  //Whole words only, like the lengths.
+  return(largest&0xFFFFFFFC);
+  }
+//============================================================================
+void EVE_RAM_G_Get_Usage(EVE_RAM_G_Usage *usage)
+  {
+  uint8_t
+    gap;
+  uint32_t
+    room;
+  usage->used=0;
+  usage->free=0;
+  usage->largest_free=0;
+  usage->blocks=EVE_RAM_G_Blocks;
+  usage->gaps=0;
+  for(gap=0;gap<=EVE_RAM_G_Blocks;gap++)
+    {
+    room=_EVE_RAM_G_Gap_End(gap)-_EVE_RAM_G_Gap_Start(gap);
+    if(0 != room)
+      {
+      usage->free+=room;
+      usage->gaps++;
+      if(usage->largest_free < room)
+        {
+        usage->largest_free=room;
+        }
+      }
+    if(gap < EVE_RAM_G_Blocks)
+      {
+      usage->used+=EVE_RAM_G_Block[gap].length;
+      }
+    }
+  }
+//----------------------------------------------------------------------------
+void EVE_RAM_G_Report(const __FlashStringHelper *label)
+  {
+#if (DEBUG_LEVEL == DEBUG_GEEK)
+  EVE_RAM_G_Usage
+    usage;
+  EVE_RAM_G_Get_Usage(&usage);
+  SerPrintFF(label);
+  //How much of the free space is not in the biggest gap, in percent.
+  DBG_GEEK(": RAM_G %lu used in %u blocks, %lu free in %u gaps, largest %lu (%lu%% fragmented)\n",
+           usage.used,usage.blocks,usage.free,usage.gaps,usage.largest_free,
+           (0 == usage.free)?0:((usage.free-usage.largest_free)*100)/usage.free);
+#else
+  (void)label;
+#endif // (DEBUG_LEVEL == DEBUG_GEEK)
+  }
+//============================================================================
+uint16_t EVE_RAM_G_Asset_Loaded(uint16_t FWol,
+                                EVE_RAM_G_Asset *asset,
+                                uint32_t address,
+                                uint32_t length)
+  {
+  uint16_t
+    copro_resets;
+  asset->address=address;
+  asset->length=length;
+  asset->crc=0;
+  if(EVE_RAM_G_NONE != address)
+    {
+    copro_resets=EVE_Copro_Resets;
+    FWol=Get_RAM_G_CRC(FWol,address,length,&asset->crc);
+    if(copro_resets != EVE_Copro_Resets)
+      {
+      //No CRC to check it against later, so it cannot count as loaded.
+      EVE_RAM_G_Asset_Release(asset);
+      }
+    }
+  return(FWol);
+  }
+//----------------------------------------------------------------------------
+uint16_t EVE_RAM_G_Asset_Verify(uint16_t FWol,
+                                EVE_RAM_G_Asset *asset)
+  {
+  uint32_t
+    crc;
+  uint16_t
+    copro_resets;
+  if(EVE_RAM_G_NONE == asset->address)
+    {
+    //Nothing there to check.
+    return(FWol);
+    }
+  copro_resets=EVE_Copro_Resets;
+  FWol=Get_RAM_G_CRC(FWol,asset->address,asset->length,&crc);
+  if(copro_resets != EVE_Copro_Resets)
+    {
+    //Cannot tell, so load it again to be sure.
+    DBG_STAT("EVE_RAM_G_Asset_Verify(): 0x%08lX could not be checked, it has to be loaded again.\n",
+             asset->address);
+    EVE_RAM_G_Asset_Release(asset);
+    }
+  else if(crc != asset->crc)
+    {
+    DBG_STAT("EVE_RAM_G_Asset_Verify(): 0x%08lX changed, it has to be loaded again.\n",
+             asset->address);
+    EVE_RAM_G_Asset_Release(asset);
+    }
+  return(FWol);
+  }
+//----------------------------------------------------------------------------
+void EVE_RAM_G_Asset_Release(EVE_RAM_G_Asset *asset)
+  {
+  if(EVE_RAM_G_NONE != asset->address)
+    {
+    EVE_RAM_G_Free(asset->address);
+    }
+  asset->address=EVE_RAM_G_NONE;
+  }
+//============================================================================
@@ -0,0 +1,124 @@
+#ifndef __EVE_RAM_G_H__
+#define __EVE_RAM_G_H__
+//============================================================================
+//
+// Hands out and takes back blocks of the EVE's RAM_G, so images, sounds
+// and display list caches can be loaded and thrown away while running,
+// instead of each one being stacked on top of the last.
+//
+// First fit, from a fixed table of blocks kept in order of address. The
+// free space is whatever lies between them, so there is nothing to merge
+// when a block is freed. Costs 8 bytes of MCU RAM per table entry.
+//
+// Crystalfontz America, Inc.
+// https://www.crystalfontz.com/products/eve-accelerated-tft-displays.php
+//===========================================================================
+//This is free and unencumbered software released into the public domain.
+//
+//Anyone is free to copy, modify, publish, use, compile, sell, or
+//distribute this software, either in source code form or as a compiled
+//binary, for any purpose, commercial or non-commercial, and by any
+//means.
+//
+//In jurisdictions that recognize copyright laws, the author or authors
+//of this software dedicate any and all copyright interest in the
+//software to the public domain. We make this dedication for the benefit
+//of the public at large and to the detriment of our heirs and
+//successors. We intend this dedication to be an overt act of
+//relinquishment in perpetuity of all present and future rights to this
+//software under copyright law.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+//EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+//OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+//ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+//OTHER DEALINGS IN THE SOFTWARE.
+//
+//For more information, please refer to <http://unlicense.org/>
+//============================================================================
+// Most blocks in use at once
+#define EVE_RAM_G_BLOCKS     (8)
+// What EVE_RAM_G_Alloc() gives back when there is no room.
+#define EVE_RAM_G_NONE       (0xFFFFFFFFUL)
+// Alignments (powers of 2 only). CMD_APPEND and bitmaps want 4 bytes,
+// REG_PLAYBACK_START 8, and ASTC blocks 16. Lengths are rounded up to a
+// multiple of 4.
+#define EVE_RAM_G_ALIGN_DL    (4)
+#define EVE_RAM_G_ALIGN_AUDIO (8)
+#if (BT815 <= EVE_DEVICE)
+#define EVE_RAM_G_ALIGN_FOR_FORMAT(format) \
+  ((EVE_FORMAT_COMPRESSED_RGBA_ASTC_4x4_KHR <= (format))?16:4)
+#else
+#define EVE_RAM_G_ALIGN_FOR_FORMAT(format) (4)
+#endif // (BT815 <= EVE_DEVICE)
+//----------------------------------------------------------------------------
+// Forget every block, all of RAM_G is free again.
+void EVE_RAM_G_Reset(void);
+// Returns the address of the new block, or EVE_RAM_G_NONE (also for a
+// length of 0).
+uint32_t EVE_RAM_G_Alloc(uint32_t length,
+                         uint8_t alignment);
+void EVE_RAM_G_Free(uint32_t address);
+// Give back the end of a block, for when it was allocated before its
+// real size was known (CMD_INFLATE, a file). It cannot grow, and keeps
+// at least 4 bytes.
+void EVE_RAM_G_Trim(uint32_t address,
+                    uint32_t length);
+// The most that EVE_RAM_G_Alloc() could get with this alignment
+uint32_t EVE_RAM_G_Largest_Free(uint8_t alignment);
+//----------------------------------------------------------------------------
+typedef struct
+  {
+  // Bytes in blocks
+  uint32_t used;
+  // Bytes between and after them
+  uint32_t free;
+  // The biggest of those gaps
+  uint32_t largest_free;
+  // Blocks in use, out of EVE_RAM_G_BLOCKS
+  uint8_t blocks;
+  // Gaps the free space is split into
+  uint8_t gaps;
+  } EVE_RAM_G_Usage;
+void EVE_RAM_G_Get_Usage(EVE_RAM_G_Usage *usage);
+// Print the usage, and how fragmented the free space is (DBG_GEEK).
+void EVE_RAM_G_Report(const __FlashStringHelper *label);
+//============================================================================
+// An image or sound loaded into RAM_G, with the CMD_MEMCRC of it from
+// right after it was loaded. RAM_G survives a coprocessor reset, but not
+// always what the coprocessor was writing when it faulted, so after one
+// EVE_RAM_G_Asset_Verify() tells which assets are still good and only
+// the others have to come off the uSD again. (EVE_Initialize() powers
+// the EVE down with EVE_PD_NOT, which loses all of RAM_G.)
+//
+//   FWol=EVE_RAM_G_Asset_Verify(FWol,&asset);
+//   if(!EVE_RAM_G_Asset_Is_Loaded(&asset))
+//     {
+//     address=... load it ...
+//     FWol=EVE_RAM_G_Asset_Loaded(FWol,&asset,address,length);
+//     }
+typedef struct
+  {
+  // EVE_RAM_G_NONE while not loaded
+  uint32_t address;
+  uint32_t length;
+  uint32_t crc;
+  } EVE_RAM_G_Asset;
+#define EVE_RAM_G_ASSET_NONE { EVE_RAM_G_NONE, 0, 0 }
+#define EVE_RAM_G_Asset_Is_Loaded(asset) (EVE_RAM_G_NONE != (asset)->address)
+// Record a block just loaded, and take its CRC. An address of
+// EVE_RAM_G_NONE (the load failed) leaves it not loaded, and so does a
+// CMD_MEMCRC that faults (the block is freed).
+uint16_t EVE_RAM_G_Asset_Loaded(uint16_t FWol,
+                                EVE_RAM_G_Asset *asset,
+                                uint32_t address,
+                                uint32_t length);
+// If its CRC has changed, or cannot be read, free the block and mark it
+// not loaded.
+uint16_t EVE_RAM_G_Asset_Verify(uint16_t FWol,
+                                EVE_RAM_G_Asset *asset);
+void EVE_RAM_G_Asset_Release(EVE_RAM_G_Asset *asset);
+//============================================================================
+#endif // __EVE_RAM_G_H__
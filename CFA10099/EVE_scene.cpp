@@ -0,0 +1,434 @@
+//============================================================================
+//
+// Retained-mode scene on top of EVE_draw.
+//
+// Crystalfontz America, Inc.
+// https://www.crystalfontz.com/products/eve-accelerated-tft-displays.php
+//===========================================================================
+//This is free and unencumbered software released into the public domain.
+//
+//Anyone is free to copy, modify, publish, use, compile, sell, or
+//distribute this software, either in source code form or as a compiled
+//binary, for any purpose, commercial or non-commercial, and by any
+//means.
+//
+//In jurisdictions that recognize copyright laws, the author or authors
+//of this software dedicate any and all copyright interest in the
+//software to the public domain. We make this dedication for the benefit
+//of the public at large and to the detriment of our heirs and
+//successors. We intend this dedication to be an overt act of
+//relinquishment in perpetuity of all present and future rights to this
+//software under copyright law.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+//EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+//OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+//ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+//OTHER DEALINGS IN THE SOFTWARE.
+//
+//For more information, please refer to <http://unlicense.org/>
+//============================================================================
+#include <Arduino.h>
+#include <SPI.h>
+
+// Definitions for our display.
+#include "CFA10099_defines.h"
+
+#include "EVE_defines.h"
+#include "EVE_spi.h"
+#include "EVE_base.h"
+#include "EVE_math.h"
+#include "EVE_draw.h"
+#include "EVE_scene.h"
+//============================================================================
+static void _EVE_Scene_Node(EVE_Scene_Node *node,
+                            uint8_t type,
+                            int16_t x,
+                            int16_t y,
+                            uint32_t color)
+  {
+  memset(node,0,sizeof(EVE_Scene_Node));
+  node->type=type;
+  node->flags=EVE_SCENE_DIRTY;
+  node->color=color;
+  node->x=x;
+  node->y=y;
+  }
+//----------------------------------------------------------------------------
+void EVE_Scene_Group(EVE_Scene_Node *node,
+                     int16_t x,
+                     int16_t y,
+                     EVE_DL_Cache *cache)
+  {
+  _EVE_Scene_Node(node,EVE_SCENE_GROUP,x,y,0);
+  node->u.group.cache=cache;
+  }
+//----------------------------------------------------------------------------
+void EVE_Scene_Rect(EVE_Scene_Node *node,
+                    int16_t x0,
+                    int16_t y0,
+                    int16_t x1,
+                    int16_t y1,
+                    uint32_t color)
+  {
+  _EVE_Scene_Node(node,EVE_SCENE_RECT,x0,y0,color);
+  node->u.rect.x1=x1;
+  node->u.rect.y1=y1;
+  }
+//----------------------------------------------------------------------------
+void EVE_Scene_Text(EVE_Scene_Node *node,
+                    int16_t x,
+                    int16_t y,
+                    uint8_t font,
+                    uint16_t options,
+                    const __FlashStringHelper *text,
+                    uint32_t color)
+  {
+  _EVE_Scene_Node(node,EVE_SCENE_TEXT,x,y,color);
+  node->u.text.text=text;
+  node->u.text.options=options;
+  node->u.text.font=font;
+  }
+//----------------------------------------------------------------------------
+void EVE_Scene_Number(EVE_Scene_Node *node,
+                      int16_t x,
+                      int16_t y,
+                      uint8_t font,
+                      uint16_t options,
+                      int32_t value,
+                      uint32_t color)
+  {
+  _EVE_Scene_Node(node,EVE_SCENE_NUMBER,x,y,color);
+  node->u.number.value=value;
+  node->u.number.options=options;
+  node->u.number.font=font;
+  }
+//----------------------------------------------------------------------------
+void EVE_Scene_Bitmap(EVE_Scene_Node *node,
+                      int16_t x,
+                      int16_t y,
+                      uint8_t handle,
+                      uint32_t color)
+  {
+  _EVE_Scene_Node(node,EVE_SCENE_BITMAP,x,y,color);
+  node->u.bitmap.handle=handle;
+  }
+//----------------------------------------------------------------------------
+void EVE_Scene_Batch(EVE_Scene_Node *node,
+                     uint8_t primitive,
+                     const int16_t *xy,
+                     uint16_t count,
+                     uint16_t size,
+                     uint32_t color)
+  {
+  _EVE_Scene_Node(node,EVE_SCENE_BATCH,0,0,color);
+  node->u.batch.xy=xy;
+  node->u.batch.count=count;
+  node->u.batch.size=size;
+  node->u.batch.primitive=primitive;
+  }
+//----------------------------------------------------------------------------
+void EVE_Scene_Add(EVE_Scene_Node *group,
+                   EVE_Scene_Node *node)
+  {
+  EVE_Scene_Node
+    **link;
+  link=&group->u.group.first;
+  while(0 != *link)
+    {
+    link=&(*link)->next;
+    }
+  *link=node;
+  node->parent=group;
+  node->next=0;
+  EVE_Scene_Mark_Dirty(node);
+  }
+//============================================================================
+void EVE_Scene_Mark_Dirty(EVE_Scene_Node *node)
+  {
+  //Every group above it has to be drawn (or recorded) again. Go all the
+  //way up, a node that was hidden may still be dirty from before.
+  while(0 != node)
+    {
+    node->flags|=EVE_SCENE_DIRTY;
+    node=node->parent;
+    }
+  }
+//----------------------------------------------------------------------------
+// The cached groups under a group that moved hold the old coordinates.
+static void _EVE_Scene_Dirty_Groups(EVE_Scene_Node *group)
+  {
+  EVE_Scene_Node
+    *node;
+  for(node=group->u.group.first;0 != node;node=node->next)
+    {
+    if(EVE_SCENE_GROUP == node->type)
+      {
+      node->flags|=EVE_SCENE_DIRTY;
+      _EVE_Scene_Dirty_Groups(node);
+      }
+    }
+  }
+//----------------------------------------------------------------------------
+void EVE_Scene_Move(EVE_Scene_Node *node,
+                    int16_t x,
+                    int16_t y)
+  {
+  if((x == node->x)&&(y == node->y))
+    {
+    return;
+    }
+  node->x=x;
+  node->y=y;
+  if(EVE_SCENE_GROUP == node->type)
+    {
+    _EVE_Scene_Dirty_Groups(node);
+    }
+  EVE_Scene_Mark_Dirty(node);
+  }
+//----------------------------------------------------------------------------
+void EVE_Scene_Set_Color(EVE_Scene_Node *node,
+                         uint32_t color)
+  {
+  if(color != node->color)
+    {
+    node->color=color;
+    EVE_Scene_Mark_Dirty(node);
+    }
+  }
+//----------------------------------------------------------------------------
+void EVE_Scene_Set_Text(EVE_Scene_Node *node,
+                        const __FlashStringHelper *text)
+  {
+  if(text != node->u.text.text)
+    {
+    node->u.text.text=text;
+    EVE_Scene_Mark_Dirty(node);
+    }
+  }
+//----------------------------------------------------------------------------
+void EVE_Scene_Set_Number(EVE_Scene_Node *node,
+                          int32_t value)
+  {
+  if(value != node->u.number.value)
+    {
+    node->u.number.value=value;
+    EVE_Scene_Mark_Dirty(node);
+    }
+  }
+//----------------------------------------------------------------------------
+void EVE_Scene_Set_Matrix(EVE_Scene_Node *group,
+                          const EVE_Matrix *matrix)
+  {
+  if(matrix != group->u.group.matrix)
+    {
+    group->u.group.matrix=matrix;
+    EVE_Scene_Mark_Dirty(group);
+    }
+  }
+//----------------------------------------------------------------------------
+void EVE_Scene_Show(EVE_Scene_Node *node,
+                    uint8_t show)
+  {
+  if((0 != show) != (0 == (node->flags&EVE_SCENE_HIDDEN)))
+    {
+    node->flags^=EVE_SCENE_HIDDEN;
+    EVE_Scene_Mark_Dirty(node);
+    }
+  }
+//============================================================================
+static uint16_t _EVE_Scene_Draw(uint16_t FWol,
+                                EVE_Scene_Node *node,
+                                int16_t x,
+                                int16_t y);
+//----------------------------------------------------------------------------
+// Everything in a group, x,y being where the group is on the screen.
+static uint16_t _EVE_Scene_Draw_Group(uint16_t FWol,
+                                      EVE_Scene_Node *group,
+                                      int16_t x,
+                                      int16_t y)
+  {
+  EVE_Scene_Node
+    *node;
+  EVE_Matrix
+    identity;
+  if(0 != group->u.group.matrix)
+    {
+    FWol=EVE_Bitmap_Transform(FWol,group->u.group.matrix);
+    }
+  for(node=group->u.group.first;0 != node;node=node->next)
+    {
+    FWol=_EVE_Scene_Draw(FWol,node,x,y);
+    }
+  if(0 != group->u.group.matrix)
+    {
+    //Leave the bitmaps after the group alone.
+    EVE_Matrix_Identity(&identity);
+    FWol=EVE_Bitmap_Transform(FWol,&identity);
+    }
+  return(FWol);
+  }
+//----------------------------------------------------------------------------
+// One node, x,y being where its group is on the screen.
+static uint16_t _EVE_Scene_Draw(uint16_t FWol,
+                                EVE_Scene_Node *node,
+                                int16_t x,
+                                int16_t y)
+  {
+  if(0 != (node->flags&EVE_SCENE_HIDDEN))
+    {
+    return(FWol);
+    }
+  node->flags&=~EVE_SCENE_DIRTY;
+  x+=node->x;
+  y+=node->y;
+  if(EVE_SCENE_GROUP == node->type)
+    {
+    if((0 != node->u.group.cache)&&
+       EVE_DL_Cache_Is_Valid(node->u.group.cache))
+      {
+      //_EVE_Scene_Record() got it up to date.
+      return(EVE_DL_Cache_Append(FWol,node->u.group.cache));
+      }
+    return(_EVE_Scene_Draw_Group(FWol,node,x,y));
+    }
+  FWol=EVE_DL_Dat_0(FWol,node->color);
+  switch(node->type)
+    {
+    case EVE_SCENE_RECT:
+      FWol=EVE_Filled_Rectangle(FWol,
+                                x,
+                                y,
+                                x+node->u.rect.x1-node->x,
+                                y+node->u.rect.y1-node->y);
+      break;
+    case EVE_SCENE_TEXT:
+      FWol=EVE_TextF(FWol,
+                     x,
+                     y,
+                     node->u.text.font,
+                     node->u.text.options,
+                     node->u.text.text);
+      break;
+    case EVE_SCENE_NUMBER:
+      FWol=EVE_Number(FWol,
+                      x,
+                      y,
+                      node->u.number.font,
+                      node->u.number.options,
+                      node->u.number.value);
+      break;
+    case EVE_SCENE_BITMAP:
+      FWol=EVE_Bitmap_Draw(FWol,node->u.bitmap.handle,x,y);
+      break;
+    case EVE_SCENE_BATCH:
+#if (FT810 <= EVE_DEVICE)
+      //The arrays are fixed, so the group moves them instead.
+      if((0 != x)||(0 != y))
+        {
+        FWol=EVE_Vertex_Translate(FWol,(int32_t)x*16,(int32_t)y*16);
+        }
+#endif // (FT810 <= EVE_DEVICE)
+      if(EVE_BEGIN_POINTS == node->u.batch.primitive)
+        {
+        FWol=EVE_Points(FWol,
+                        node->u.batch.xy,
+                        node->u.batch.count,
+                        node->u.batch.size,
+                        0,
+                        0);
+        }
+      else if(EVE_BEGIN_LINES == node->u.batch.primitive)
+        {
+        FWol=EVE_Lines(FWol,
+                       node->u.batch.xy,
+                       node->u.batch.count,
+                       node->u.batch.size/16,
+                       0);
+        }
+      else
+        {
+        //EVE_Rects() takes whole pixels, and needs at least 1 for the
+        //corners to stay sharp.
+        FWol=EVE_Rects(FWol,
+                       node->u.batch.xy,
+                       node->u.batch.count,
+                       (16 <= node->u.batch.size)?node->u.batch.size/16:1,
+                       0);
+        }
+#if (FT810 <= EVE_DEVICE)
+      if((0 != x)||(0 != y))
+        {
+        FWol=EVE_Vertex_Translate(FWol,0,0);
+        }
+#endif // (FT810 <= EVE_DEVICE)
+      break;
+    }
+  return(FWol);
+  }
+//----------------------------------------------------------------------------
+// Bring the caches of the dirty groups up to date, innermost first so
+// the outer ones can append them. This builds display lists of its own,
+// so it has to happen before the frame is started.
+static uint16_t _EVE_Scene_Record(uint16_t FWol,
+                                  EVE_Scene_Node *group,
+                                  int16_t x,
+                                  int16_t y)
+  {
+  EVE_Scene_Node
+    *node;
+  if(0 != (group->flags&EVE_SCENE_HIDDEN))
+    {
+    return(FWol);
+    }
+  if(0 == (group->flags&EVE_SCENE_DIRTY))
+    {
+    //Nothing under here changed.
+    return(FWol);
+    }
+  x+=group->x;
+  y+=group->y;
+  for(node=group->u.group.first;0 != node;node=node->next)
+    {
+    if(EVE_SCENE_GROUP == node->type)
+      {
+      FWol=_EVE_Scene_Record(FWol,node,x,y);
+      }
+    }
+  if((0 != group->u.group.cache)&&
+     (0 != group->u.group.cache->capacity))
+    {
+    EVE_DL_Cache_Invalidate(group->u.group.cache);
+    FWol=EVE_DL_Cache_Record_Start(FWol);
+    //Where the recording lands in the frame, the state could be anything.
+    EVE_DL_State_Forget();
+    FWol=_EVE_Scene_Draw_Group(FWol,group,x,y);
+    FWol=EVE_DL_Cache_Record_End(FWol,group->u.group.cache);
+    }
+  return(FWol);
+  }
+//----------------------------------------------------------------------------
+uint16_t EVE_Scene_Frame(uint16_t FWol,
+                         EVE_Scene_Node *root,
+                         uint32_t clear_color)
+  {
+  if(!EVE_Scene_Changed(root))
+    {
+    return(FWol);
+    }
+  FWol=_EVE_Scene_Record(FWol,root,0,0);
+  FWol=EVE_DL_Dat_0(FWol,EVE_ENC_CMD_DLSTART);
+  FWol=EVE_DL_Dat_0(FWol,clear_color);
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_CLEAR(1 /*CLR_COL*/,1 /*CLR_STN*/,1 /*CLR_TAG*/));
+  //The registered images, for the bitmap nodes
+  FWol=EVE_Bitmap_Prologue(FWol);
+  FWol=_EVE_Scene_Draw(FWol,root,0,0);
+  FWol=EVE_DL_Dat_0(FWol,EVE_ENC_DISPLAY());
+  FWol=EVE_Cmd_Dat_0(FWol,EVE_ENC_CMD_SWAP);
+  EVE_Cmd_Flush(FWol);
+  return(FWol);
+  }
+//============================================================================
@@ -0,0 +1,185 @@
+#ifndef __EVE_SCENE_H__
+#define __EVE_SCENE_H__
+//============================================================================
+//
+// A retained-mode scene on top of EVE_draw: the screen is described once
+// as a tree of nodes, changes go through setters that mark what they touch
+// as dirty, and a frame is only built and sent when something changed.
+//
+// A group can keep its part of the frame in a EVE_DL_Cache. While nothing
+// under it changes, the whole subtree costs one CMD_APPEND.
+//
+// Crystalfontz America, Inc.
+// https://www.crystalfontz.com/products/eve-accelerated-tft-displays.php
+//===========================================================================
+//This is free and unencumbered software released into the public domain.
+//
+//Anyone is free to copy, modify, publish, use, compile, sell, or
+//distribute this software, either in source code form or as a compiled
+//binary, for any purpose, commercial or non-commercial, and by any
+//means.
+//
+//In jurisdictions that recognize copyright laws, the author or authors
+//of this software dedicate any and all copyright interest in the
+//software to the public domain. We make this dedication for the benefit
+//of the public at large and to the detriment of our heirs and
+//successors. We intend this dedication to be an overt act of
+//relinquishment in perpetuity of all present and future rights to this
+//software under copyright law.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+//EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+//OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+//ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+//OTHER DEALINGS IN THE SOFTWARE.
+//
+//For more information, please refer to <http://unlicense.org/>
+//============================================================================
+// Node types
+#define EVE_SCENE_GROUP   (0)
+#define EVE_SCENE_RECT    (1)
+#define EVE_SCENE_TEXT    (2)
+#define EVE_SCENE_NUMBER  (3)
+#define EVE_SCENE_BITMAP  (4)
+#define EVE_SCENE_BATCH   (5)
+// Node flags
+// Changed since the last frame (for a group: something under it did)
+#define EVE_SCENE_DIRTY   (0x01)
+// Not drawn, nor is anything under it
+#define EVE_SCENE_HIDDEN  (0x02)
+//----------------------------------------------------------------------------
+// The nodes belong to the caller, usually as globals, and are linked
+// together with EVE_Scene_Add(). Coordinates are whole pixels relative to
+// the group the node is in. Each node is 21 bytes on the AVR.
+typedef struct EVE_Scene_Node
+  {
+  struct EVE_Scene_Node *parent;
+  // The next node in the same group
+  struct EVE_Scene_Node *next;
+  uint8_t type;
+  uint8_t flags;
+  // EVE_ENC_COLOR_RGB(), unused by groups
+  uint32_t color;
+  int16_t x;
+  int16_t y;
+  union
+    {
+    struct
+      {
+      struct EVE_Scene_Node *first;
+      // NULL to draw the group every frame
+      EVE_DL_Cache *cache;
+      // Applied to the bitmaps in the group, NULL for none
+      const EVE_Matrix *matrix;
+      } group;
+    struct
+      {
+      // Opposite corner, relative to the group like x,y
+      int16_t x1;
+      int16_t y1;
+      } rect;
+    struct
+      {
+      // In flash
+      const __FlashStringHelper *text;
+      uint16_t options;
+      uint8_t font;
+      } text;
+    struct
+      {
+      int32_t value;
+      uint16_t options;
+      uint8_t font;
+      } number;
+    struct
+      {
+      uint8_t handle;
+      } bitmap;
+    struct
+      {
+      // As EVE_Points()/EVE_Lines()/EVE_Rects() take them. On FT81x
+      // they are moved by x,y and the group with VERTEX_TRANSLATE,
+      // earlier EVEs draw them where they are.
+      const int16_t *xy;
+      uint16_t count;
+      // Point size, line width or rectangle corner, 1/16 pixels. Lines
+      // and rectangles are drawn to the whole pixel, 0 gives rectangles
+      // sharp corners.
+      uint16_t size;
+      // EVE_BEGIN_POINTS, EVE_BEGIN_LINES or EVE_BEGIN_RECTS
+      uint8_t primitive;
+      } batch;
+    } u;
+  } EVE_Scene_Node;
+//----------------------------------------------------------------------------
+// Set up a node. A new node is dirty, so the first frame draws it.
+void EVE_Scene_Group(EVE_Scene_Node *node,
+                     int16_t x,
+                     int16_t y,
+                     EVE_DL_Cache *cache);
+void EVE_Scene_Rect(EVE_Scene_Node *node,
+                    int16_t x0,
+                    int16_t y0,
+                    int16_t x1,
+                    int16_t y1,
+                    uint32_t color);
+void EVE_Scene_Text(EVE_Scene_Node *node,
+                    int16_t x,
+                    int16_t y,
+                    uint8_t font,
+                    uint16_t options,
+                    const __FlashStringHelper *text,
+                    uint32_t color);
+void EVE_Scene_Number(EVE_Scene_Node *node,
+                      int16_t x,
+                      int16_t y,
+                      uint8_t font,
+                      uint16_t options,
+                      int32_t value,
+                      uint32_t color);
+void EVE_Scene_Bitmap(EVE_Scene_Node *node,
+                      int16_t x,
+                      int16_t y,
+                      uint8_t handle,
+                      uint32_t color);
+void EVE_Scene_Batch(EVE_Scene_Node *node,
+                     uint8_t primitive,
+                     const int16_t *xy,
+                     uint16_t count,
+                     uint16_t size,
+                     uint32_t color);
+// Put node at the end of group's list, so it is drawn on top.
+void EVE_Scene_Add(EVE_Scene_Node *group,
+                   EVE_Scene_Node *node);
+//----------------------------------------------------------------------------
+// Changes. These only mark the node dirty if the value really changed.
+void EVE_Scene_Move(EVE_Scene_Node *node,
+                    int16_t x,
+                    int16_t y);
+void EVE_Scene_Set_Color(EVE_Scene_Node *node,
+                         uint32_t color);
+void EVE_Scene_Set_Text(EVE_Scene_Node *node,
+                        const __FlashStringHelper *text);
+void EVE_Scene_Set_Number(EVE_Scene_Node *node,
+                          int32_t value);
+void EVE_Scene_Set_Matrix(EVE_Scene_Node *group,
+                          const EVE_Matrix *matrix);
+void EVE_Scene_Show(EVE_Scene_Node *node,
+                    uint8_t show);
+// For anything changed behind the scene's back, like the contents of a
+// batch's array or the matrix a group points at.
+void EVE_Scene_Mark_Dirty(EVE_Scene_Node *node);
+//----------------------------------------------------------------------------
+// The frame is only worth sending if this is true.
+#define EVE_Scene_Changed(root) (0 != ((root)->flags&EVE_SCENE_DIRTY))
+// If anything changed, record the group caches that need it, then build
+// the frame from root (cleared to clear_color, EVE_ENC_CLEAR_COLOR_RGB())
+// and swap it in. Otherwise nothing is sent and the EVE keeps showing
+// the last one.
+uint16_t EVE_Scene_Frame(uint16_t FWol,
+                         EVE_Scene_Node *root,
+                         uint32_t clear_color);
+//============================================================================
+#endif // __EVE_SCENE_H__
@@ -0,0 +1,681 @@
+//============================================================================
+//
+// SPI transports for FTDI / BridgeTek EVE graphic accelerators. See
+// EVE_spi.h for what each one is for.
+//
+// Crystalfontz America, Inc.
+// https://www.crystalfontz.com/products/eve-accelerated-tft-displays.php
+//This is free and unencumbered software released into the public domain.
+//
+//Anyone is free to copy, modify, publish, use, compile, sell, or
+//distribute this software, either in source code form or as a compiled
+//binary, for any purpose, commercial or non-commercial, and by any
+//means.
+//
+//In jurisdictions that recognize copyright laws, the author or authors
+//of this software dedicate any and all copyright interest in the
+//software to the public domain. We make this dedication for the benefit
+//of the public at large and to the detriment of our heirs and
+//successors. We intend this dedication to be an overt act of
+//relinquishment in perpetuity of all present and future rights to this
+//software under copyright law.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+//EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+//OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+//ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+//OTHER DEALINGS IN THE SOFTWARE.
+//
+//For more information, please refer to <http://unlicense.org/>
+//============================================================================
+#include <Arduino.h>
+#include <SPI.h>
+#include <string.h>
+
+// Definitions for our display.
+#include "CFA10099_defines.h"
+
+#include "EVE_defines.h"
+#include "EVE_spi.h"
+#include "EVE_base.h"
+
+#if (EVE_SPI_TRANSPORT == EVE_SPI_SPIDEV)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/spi/spidev.h>
+#endif // (EVE_SPI_TRANSPORT == EVE_SPI_SPIDEV)
+//============================================================================
+#if (0 != EVE_SPI_STATISTICS)
+// Running totals of CS# cycles and bytes exchanged with the EVE. The
+// caller clears these whenever it wants to start a measurement.
+uint32_t
+  EVE_SPI_Transactions;
+uint32_t
+  EVE_SPI_Bytes;
+#endif // (0 != EVE_SPI_STATISTICS)
+//============================================================================
+#if (EVE_SPI_TRANSPORT == EVE_SPI_ARDUINO)
+// Select, deselect and single bytes are inline in EVE_spi.h
+#if defined(__AVR__)
+// The AVR SPI has no FIFO, but SPDR can be loaded the moment SPIF says the
+// previous byte is done. Fetching the next byte (from RAM or flash) while
+// the current one is still shifting out hides the fetch and loop overhead,
+// so at 8MHz the bytes go out nearly back-to-back.
+//----------------------------------------------------------------------------
+void EVE_SPI_Write_Burst(const uint8_t *data, uint16_t length)
+  {
+  if(0 == length)
+    {
+    return;
+    }
+  EVE_STAT_BYTES(length);
+  //Start the first byte shifting out
+  SPDR=*data;
+  while(0 != --length)
+    {
+    uint8_t
+      next;
+    //Fetch the next byte while the current one shifts
+    data++;
+    next=*data;
+    //Wait for the current byte to finish, then start the next one
+    while(!(SPSR & _BV(SPIF)));
+    SPDR=next;
+    }
+  //Wait for the last byte, reading SPDR clears SPIF
+  while(!(SPSR & _BV(SPIF)));
+  (void)SPDR;
+  }
+//----------------------------------------------------------------------------
+void EVE_SPI_Write_Burst_P(const uint8_t *flash_data, uint16_t length)
+  {
+  if(0 == length)
+    {
+    return;
+    }
+  EVE_STAT_BYTES(length);
+  //Start the first byte shifting out
+  SPDR=pgm_read_byte(flash_data);
+  while(0 != --length)
+    {
+    uint8_t
+      next;
+    //The LPM flash read is hidden behind the shift
+    flash_data++;
+    next=pgm_read_byte(flash_data);
+    //Wait for the current byte to finish, then start the next one
+    while(!(SPSR & _BV(SPIF)));
+    SPDR=next;
+    }
+  //Wait for the last byte, reading SPDR clears SPIF
+  while(!(SPSR & _BV(SPIF)));
+  (void)SPDR;
+  }
+//----------------------------------------------------------------------------
+void EVE_SPI_Read_Burst(uint8_t *data, uint16_t length)
+  {
+  if(0 == length)
+    {
+    return;
+    }
+  EVE_STAT_BYTES(length);
+  //Start the first dummy byte
+  SPDR=0;
+  while(0 != --length)
+    {
+    uint8_t
+      in;
+    //Grab the byte that just came in, and immediately start the next
+    //dummy. Storing the byte overlaps with the shift.
+    while(!(SPSR & _BV(SPIF)));
+    in=SPDR;
+    SPDR=0;
+    *data=in;
+    data++;
+    }
+  //Last byte
+  while(!(SPSR & _BV(SPIF)));
+  *data=SPDR;
+  }
+#else // defined(__AVR__)
+//----------------------------------------------------------------------------
+// Other Arduino cores: the buffer form of SPI.transfer() lets the core
+// use its FIFO or DMA, but it overwrites the buffer with what comes back.
+// So the data is copied through a small SRAM window first.
+void EVE_SPI_Write_Burst(const uint8_t *data, uint16_t length)
+  {
+  uint8_t
+    window[EVE_SPI_WINDOW_SIZE];
+  EVE_STAT_BYTES(length);
+  while(0 != length)
+    {
+    uint16_t
+      this_window;
+    this_window=(length < EVE_SPI_WINDOW_SIZE)?length:EVE_SPI_WINDOW_SIZE;
+    memcpy(window,data,this_window);
+    SPI.transfer(window,this_window);
+    data+=this_window;
+    length-=this_window;
+    }
+  }
+//----------------------------------------------------------------------------
+void EVE_SPI_Write_Burst_P(const uint8_t *flash_data, uint16_t length)
+  {
+  uint8_t
+    window[EVE_SPI_WINDOW_SIZE];
+  EVE_STAT_BYTES(length);
+  while(0 != length)
+    {
+    uint16_t
+      this_window;
+    this_window=(length < EVE_SPI_WINDOW_SIZE)?length:EVE_SPI_WINDOW_SIZE;
+    memcpy_P(window,flash_data,this_window);
+    SPI.transfer(window,this_window);
+    flash_data+=this_window;
+    length-=this_window;
+    }
+  }
+//----------------------------------------------------------------------------
+void EVE_SPI_Read_Burst(uint8_t *data, uint16_t length)
+  {
+  EVE_STAT_BYTES(length);
+  //SPI.transfer() sends the buffer while it reads into it, so clear it
+  //first to send dummy zeros.
+  memset(data,0,length);
+  SPI.transfer(data,length);
+  }
+#endif // defined(__AVR__)
+#else // (EVE_SPI_TRANSPORT == EVE_SPI_ARDUINO)
+//----------------------------------------------------------------------------
+// Off-target there is no separate flash, PROGMEM data is just memory.
+void EVE_SPI_Write_Burst_P(const uint8_t *flash_data, uint16_t length)
+  {
+  EVE_SPI_Write_Burst(flash_data,length);
+  }
+#endif // (EVE_SPI_TRANSPORT == EVE_SPI_ARDUINO)
+//============================================================================
+#if (EVE_SPI_TRANSPORT == EVE_SPI_SPIDEV)
+// spidev cannot hold CS# low between system calls on its own, so the
+// bytes of a transaction are queued up here and sent with a single
+// SPI_IOC_MESSAGE when the transaction ends. Since reads are always the
+// last thing in a transaction, a read sends the queued address + dummy
+// and clocks in the reply in the same message.
+//
+// 4096 is the default spidev "bufsiz" module parameter, the most that can
+// go in one message.
+#define EVE_SPIDEV_QUEUE_SIZE (4096)
+static int
+  EVE_SPIDEV_fd=-1;
+static uint8_t
+  EVE_SPIDEV_Queue[EVE_SPIDEV_QUEUE_SIZE];
+static uint16_t
+  EVE_SPIDEV_Queued;
+// Non-zero once the transaction's bytes have gone out (and CS# released)
+static uint8_t
+  EVE_SPIDEV_Done;
+//----------------------------------------------------------------------------
+// Send what is in the queue, optionally with a read tacked on. If
+// keep_selected is set, ask the driver to leave CS# low afterwards so the
+// transaction can continue in another message.
+static void EVE_SPIDEV_Flush(uint8_t *read_data, uint16_t read_length,
+                             uint8_t keep_selected)
+  {
+  struct spi_ioc_transfer
+    xfer[2];
+  uint8_t
+    count;
+  memset(xfer,0,sizeof(xfer));
+  count=0;
+  if(0 != EVE_SPIDEV_Queued)
+    {
+    xfer[count].tx_buf=(unsigned long)EVE_SPIDEV_Queue;
+    xfer[count].len=EVE_SPIDEV_Queued;
+    xfer[count].speed_hz=EVE_SPIDEV_SPEED;
+    xfer[count].bits_per_word=8;
+    count++;
+    }
+  if(0 != read_length)
+    {
+    //No tx_buf means the driver sends zeros.
+    xfer[count].rx_buf=(unsigned long)read_data;
+    xfer[count].len=read_length;
+    xfer[count].speed_hz=EVE_SPIDEV_SPEED;
+    xfer[count].bits_per_word=8;
+    count++;
+    }
+  if(0 == count)
+    {
+    return;
+    }
+  //On the last transfer of a message, cs_change means "stay selected".
+  xfer[count-1].cs_change=keep_selected;
+  if(ioctl(EVE_SPIDEV_fd,SPI_IOC_MESSAGE(count),xfer) < 0)
+    {
+    DBG_STAT("spidev transfer failed.\n");
+    }
+  EVE_SPIDEV_Queued=0;
+  }
+//----------------------------------------------------------------------------
+uint8_t EVE_SPI_Begin(void)
+  {
+  uint8_t
+    mode;
+  uint8_t
+    bits;
+  uint32_t
+    speed;
+  if(0 <= EVE_SPIDEV_fd)
+    {
+    //Already open
+    return(0);
+    }
+  EVE_SPIDEV_fd=open(EVE_SPIDEV_DEVICE,O_RDWR);
+  if(EVE_SPIDEV_fd < 0)
+    {
+    DBG_STAT("Cannot open %s.\n",EVE_SPIDEV_DEVICE);
+    return(1);
+    }
+  //EVE is SPI mode 0, MSB first, 8 bits
+  mode=SPI_MODE_0;
+  bits=8;
+  speed=EVE_SPIDEV_SPEED;
+  if((ioctl(EVE_SPIDEV_fd,SPI_IOC_WR_MODE,&mode) < 0) ||
+     (ioctl(EVE_SPIDEV_fd,SPI_IOC_WR_BITS_PER_WORD,&bits) < 0) ||
+     (ioctl(EVE_SPIDEV_fd,SPI_IOC_WR_MAX_SPEED_HZ,&speed) < 0))
+    {
+    DBG_STAT("Cannot configure %s.\n",EVE_SPIDEV_DEVICE);
+    close(EVE_SPIDEV_fd);
+    EVE_SPIDEV_fd=-1;
+    return(1);
+    }
+  return(0);
+  }
+//----------------------------------------------------------------------------
+void EVE_SPI_Select(void)
+  {
+  EVE_STAT_TRANSACTION();
+  EVE_SPIDEV_Queued=0;
+  EVE_SPIDEV_Done=0;
+  }
+//----------------------------------------------------------------------------
+void EVE_SPI_Deselect(void)
+  {
+  if(0 == EVE_SPIDEV_Done)
+    {
+    EVE_SPIDEV_Flush(0,0,0);
+    EVE_SPIDEV_Done=1;
+    }
+  }
+//----------------------------------------------------------------------------
+void EVE_SPI_Write_8(uint8_t data)
+  {
+  EVE_STAT_BYTES(1);
+  //Only flush a full queue when there is more to send, so there is always
+  //something left to end the transaction with.
+  if(EVE_SPIDEV_QUEUE_SIZE == EVE_SPIDEV_Queued)
+    {
+    EVE_SPIDEV_Flush(0,0,1);
+    }
+  EVE_SPIDEV_Queue[EVE_SPIDEV_Queued]=data;
+  EVE_SPIDEV_Queued++;
+  }
+//----------------------------------------------------------------------------
+void EVE_SPI_Write_Burst(const uint8_t *data, uint16_t length)
+  {
+  while(0 != length)
+    {
+    EVE_SPI_Write_8(*data);
+    data++;
+    length--;
+    }
+  }
+//----------------------------------------------------------------------------
+void EVE_SPI_Read_Burst(uint8_t *data, uint16_t length)
+  {
+  EVE_STAT_BYTES(length);
+  //Address and dummy byte, then the reply, then release CS#.
+  EVE_SPIDEV_Flush(data,length,0);
+  EVE_SPIDEV_Done=1;
+  }
+#endif // (EVE_SPI_TRANSPORT == EVE_SPI_SPIDEV)
+//============================================================================
+#if (EVE_SPI_TRANSPORT == EVE_SPI_RECORD)
+EVE_SPI_Record_Entry
+  EVE_SPI_Record_Log[EVE_SPI_RECORD_LOG_SIZE];
+uint16_t
+  EVE_SPI_Record_Log_Next;
+uint32_t
+  EVE_SPI_Record_Transactions;
+uint32_t
+  EVE_SPI_Record_Bytes_Written;
+uint32_t
+  EVE_SPI_Record_Bytes_Read;
+void
+  (*EVE_SPI_Record_Swap_Hook)(void);
+// The register page of the pretend EVE. Writes land here, and reads come
+// back from here, which is enough for the library's polling loops.
+#define EVE_RECORD_REG_SIZE (0x1000)
+static uint8_t
+  EVE_Record_REG[EVE_RECORD_REG_SIZE];
+// First three bytes of the current transaction, then the data byte count
+static uint32_t
+  EVE_Record_Address;
+static uint16_t
+  EVE_Record_Count;
+// The word the pretend coprocessor is putting together out of the bytes
+// written to the command ring, and how many bytes it has.
+static uint32_t
+  EVE_Record_Cmd_Word;
+static uint8_t
+  EVE_Record_Cmd_Bytes;
+// The pretend display runs at 60Hz, from when EVE_SPI_Begin() was called.
+#define EVE_RECORD_FRAME_US (16667)
+static uint32_t
+  EVE_Record_Start_us;
+//----------------------------------------------------------------------------
+static void EVE_Record_Set_32(uint32_t address, uint32_t data)
+  {
+  address-=EVE_RAM_REG;
+  EVE_Record_REG[address+0]=(uint8_t)(data);
+  EVE_Record_REG[address+1]=(uint8_t)(data >> 8);
+  EVE_Record_REG[address+2]=(uint8_t)(data >> 16);
+  EVE_Record_REG[address+3]=(uint8_t)(data >> 24);
+  }
+//----------------------------------------------------------------------------
+// Bring EVE_REG_FRAMES and EVE_REG_CLOCK up to date, so frame pacing sees
+// the display running.
+static void EVE_Record_Tick(void)
+  {
+  uint32_t
+    elapsed_us;
+  elapsed_us=micros()-EVE_Record_Start_us;
+  EVE_Record_Set_32(EVE_REG_FRAMES,elapsed_us/EVE_RECORD_FRAME_US);
+  EVE_Record_Set_32(EVE_REG_CLOCK,elapsed_us*(EVE_CLOCK_SPEED/1000000UL));
+  }
+//----------------------------------------------------------------------------
+// The pretend coprocessor runs each word as soon as it is written. Display
+// list commands go to RAM_DL, so EVE_REG_CMD_DL moves on 4 for each of
+// them, and CMD_DLSTART takes it back to 0. It does not know how many
+// parameters each coprocessor command has, so parameters are counted as
+// display list too. That is close enough for the EVE_DL_Cache and
+// EVE_scene recordings to have something in them.
+static void EVE_Record_Cmd_Byte(uint8_t data)
+  {
+  uint32_t
+    cmd_dl;
+  EVE_Record_Cmd_Word=(EVE_Record_Cmd_Word >> 8)|((uint32_t)data << 24);
+  EVE_Record_Cmd_Bytes++;
+  if(4 != EVE_Record_Cmd_Bytes)
+    {
+    return;
+    }
+  EVE_Record_Cmd_Bytes=0;
+  if(EVE_ENC_CMD_DLSTART == EVE_Record_Cmd_Word)
+    {
+    EVE_Record_Set_32(EVE_REG_CMD_DL,0);
+    }
+  else if(EVE_ENC_CMD_SWAP == EVE_Record_Cmd_Word)
+    {
+    if(0 != EVE_SPI_Record_Swap_Hook)
+      {
+      EVE_SPI_Record_Swap_Hook();
+      }
+    }
+  else if(0xFFFFFF00UL != (EVE_Record_Cmd_Word & 0xFFFFFF00UL))
+    {
+    cmd_dl=((uint32_t)EVE_Record_REG[EVE_REG_CMD_DL-EVE_RAM_REG] |
+            ((uint32_t)EVE_Record_REG[EVE_REG_CMD_DL+1-EVE_RAM_REG] << 8));
+    EVE_Record_Set_32(EVE_REG_CMD_DL,(cmd_dl+4)&(EVE_RAM_DL_SIZE-1));
+    }
+  }
+//----------------------------------------------------------------------------
+void EVE_SPI_Record_Clear(void)
+  {
+  memset(EVE_SPI_Record_Log,0,sizeof(EVE_SPI_Record_Log));
+  EVE_SPI_Record_Log_Next=0;
+  EVE_SPI_Record_Transactions=0;
+  EVE_SPI_Record_Bytes_Written=0;
+  EVE_SPI_Record_Bytes_Read=0;
+  }
+//----------------------------------------------------------------------------
+uint8_t EVE_SPI_Begin(void)
+  {
+  EVE_SPI_Record_Clear();
+  //Power-on state of the registers the library waits on.
+  memset(EVE_Record_REG,0,sizeof(EVE_Record_REG));
+  EVE_Record_Cmd_Bytes=0;
+  EVE_Record_REG[EVE_REG_ID-EVE_RAM_REG]=0x7C;
+  EVE_Record_Start_us=micros();
+  //Nobody is touching the screen.
+  EVE_Record_Set_32(EVE_REG_TOUCH_SCREEN_XY,0x80008000);
+  EVE_Record_Set_32(EVE_REG_CTOUCH_TOUCH1_XY,0x80008000);
+  EVE_Record_Set_32(EVE_REG_CTOUCH_TOUCH2_XY,0x80008000);
+  EVE_Record_Set_32(EVE_REG_CTOUCH_TOUCH3_XY,0x80008000);
+  EVE_Record_Set_32(EVE_REG_CTOUCH_TOUCH4_X,0x80008000);
+  EVE_Record_Set_32(EVE_REG_CTOUCH_TOUCH4_Y,0x80008000);
+#ifdef EVE_REG_CMDB_WRITE
+  //The command FIFO is empty.
+  EVE_Record_Set_32(EVE_REG_CMDB_SPACE,0xFFC);
+#endif // EVE_REG_CMDB_WRITE
+  return(0);
+  }
+//----------------------------------------------------------------------------
+void EVE_SPI_Select(void)
+  {
+  EVE_STAT_TRANSACTION();
+  EVE_Record_Address=0;
+  EVE_Record_Count=0;
+  EVE_SPI_Record_Transactions++;
+  }
+//----------------------------------------------------------------------------
+void EVE_SPI_Deselect(void)
+  {
+  EVE_SPI_Record_Entry
+    *entry;
+  entry=&EVE_SPI_Record_Log[EVE_SPI_Record_Log_Next];
+  entry->address=EVE_Record_Address;
+  //Do not count the address bytes
+  entry->length=(3 < EVE_Record_Count)?(EVE_Record_Count-3):0;
+  EVE_SPI_Record_Log_Next=(EVE_SPI_Record_Log_Next+1)%EVE_SPI_RECORD_LOG_SIZE;
+  }
+//----------------------------------------------------------------------------
+void EVE_SPI_Write_8(uint8_t data)
+  {
+  EVE_STAT_BYTES(1);
+  EVE_SPI_Record_Bytes_Written++;
+  if(EVE_Record_Count < 3)
+    {
+    //Still collecting the operation and address
+    EVE_Record_Address=(EVE_Record_Address << 8)|data;
+    }
+  else if(EVE_MEM_WRITE & (EVE_Record_Address >> 16))
+    {
+    uint32_t
+      address;
+    address=(EVE_Record_Address&0x3FFFFF)+(EVE_Record_Count-3);
+#ifdef EVE_REG_CMDB_WRITE
+    if(EVE_REG_CMDB_WRITE == (EVE_Record_Address&0x3FFFFF))
+      {
+      //Everything written here goes into the command FIFO. Each whole
+      //word advances CMD_WRITE, and the pretend coprocessor (which
+      //finishes instantly) CMD_READ with it.
+      if(3 == ((EVE_Record_Count-3)&0x03))
+        {
+        uint16_t
+          offset;
+        offset=((uint16_t)EVE_Record_REG[EVE_REG_CMD_WRITE-EVE_RAM_REG] |
+                ((uint16_t)EVE_Record_REG[EVE_REG_CMD_WRITE+1-EVE_RAM_REG] << 8));
+        offset=(offset+4)&0xFFF;
+        EVE_Record_Set_32(EVE_REG_CMD_WRITE,offset);
+        EVE_Record_Set_32(EVE_REG_CMD_READ,offset);
+        }
+      EVE_Record_Cmd_Byte(data);
+      EVE_Record_Count++;
+      return;
+      }
+#endif // EVE_REG_CMDB_WRITE
+    if((EVE_RAM_REG <= address) &&
+       (address < EVE_RAM_REG+EVE_RECORD_REG_SIZE))
+      {
+      EVE_Record_REG[address-EVE_RAM_REG]=data;
+      //The pretend coprocessor finishes everything instantly, so it has
+      //always read up to wherever the host has written.
+      if((EVE_REG_CMD_WRITE <= address)&&(address < EVE_REG_CMD_WRITE+4))
+        {
+        EVE_Record_REG[address-EVE_REG_CMD_WRITE+EVE_REG_CMD_READ-EVE_RAM_REG]=data;
+        }
+      }
+    else if((EVE_RAM_CMD <= address) && (address < EVE_RAM_CMD+4096))
+      {
+      EVE_Record_Cmd_Byte(data);
+      }
+    }
+  EVE_Record_Count++;
+  }
+//----------------------------------------------------------------------------
+void EVE_SPI_Write_Burst(const uint8_t *data, uint16_t length)
+  {
+  while(0 != length)
+    {
+    EVE_SPI_Write_8(*data);
+    data++;
+    length--;
+    }
+  }
+//----------------------------------------------------------------------------
+void EVE_SPI_Read_Burst(uint8_t *data, uint16_t length)
+  {
+  uint32_t
+    address;
+  EVE_STAT_BYTES(length);
+  EVE_SPI_Record_Bytes_Read+=length;
+  //Skip the dummy byte
+  address=(EVE_Record_Address&0x3FFFFF)+(EVE_Record_Count-4);
+  EVE_Record_Count+=length;
+  EVE_Record_Tick();
+  while(0 != length)
+    {
+    if((EVE_RAM_REG <= address) &&
+       (address < EVE_RAM_REG+EVE_RECORD_REG_SIZE))
+      {
+      *data=EVE_Record_REG[address-EVE_RAM_REG];
+      }
+    else if((EVE_CHIP_ID_ADDRESS <= address)&&(address < EVE_CHIP_ID_ADDRESS+4))
+      {
+      //Chip Identification Code: 0x0001nn08, nn = EVE_DEVICE
+      static const uint8_t
+        chip_id[4]={0x08,EVE_DEVICE,0x01,0x00};
+      *data=chip_id[address-EVE_CHIP_ID_ADDRESS];
+      }
+    else
+      {
+      *data=0;
+      }
+    data++;
+    address++;
+    length--;
+    }
+  }
+#endif // (EVE_SPI_TRANSPORT == EVE_SPI_RECORD)
+//============================================================================
+#if (0 != EVE_SPI_BENCHMARK)
+// Each path moves the same number of bytes in one long transaction so
+// that only the per-byte cost is measured.
+#define EVE_SPI_BENCHMARK_BLOCK  (32)
+#define EVE_SPI_BENCHMARK_BLOCKS (64)
+static const uint8_t EVE_SPI_Benchmark_Pattern[EVE_SPI_BENCHMARK_BLOCK] PROGMEM =
+  {
+  0x00,0x11,0x22,0x33,0x44,0x55,0x66,0x77,0x88,0x99,0xAA,0xBB,0xCC,0xDD,0xEE,0xFF,
+  0xFF,0xEE,0xDD,0xCC,0xBB,0xAA,0x99,0x88,0x77,0x66,0x55,0x44,0x33,0x22,0x11,0x00
+  };
+//----------------------------------------------------------------------------
+static void EVE_SPI_Benchmark_Address(uint32_t Address, uint8_t Operation)
+  {
+  EVE_SPI_Select();
+  EVE_SPI_Write_8((uint8_t)(Address >> 16) | Operation);
+  EVE_SPI_Write_8((uint8_t)(Address >> 8));
+  EVE_SPI_Write_8((uint8_t)(Address));
+  }
+//----------------------------------------------------------------------------
+static uint32_t EVE_SPI_Benchmark_Rate(uint32_t start_us)
+  {
+  uint32_t
+    elapsed_us;
+  elapsed_us=micros()-start_us;
+  if(0 == elapsed_us)
+    {
+    elapsed_us=1;
+    }
+  //2048 bytes * 1000000 still fits in a uint32_t
+  return(((uint32_t)EVE_SPI_BENCHMARK_BLOCK*EVE_SPI_BENCHMARK_BLOCKS*1000000UL)/
+         elapsed_us);
+  }
+//----------------------------------------------------------------------------
+void EVE_SPI_Benchmark(uint32_t RAM_G_Scratch)
+  {
+  uint8_t
+    buffer[EVE_SPI_BENCHMARK_BLOCK];
+  uint8_t
+    block;
+  uint8_t
+    i;
+  uint32_t
+    start_us;
+  //Nothing else may be holding the EVE selected
+  EVE_Cmd_Burst_Close();
+  memcpy_P(buffer,EVE_SPI_Benchmark_Pattern,EVE_SPI_BENCHMARK_BLOCK);
+  DBG_STAT("SPI benchmark, %u bytes per path:\n",
+           EVE_SPI_BENCHMARK_BLOCK*EVE_SPI_BENCHMARK_BLOCKS);
+
+  //The old way: one call per byte
+  start_us=micros();
+  EVE_SPI_Benchmark_Address(RAM_G_Scratch,EVE_MEM_WRITE);
+  for(block=0;block<EVE_SPI_BENCHMARK_BLOCKS;block++)
+    {
+    for(i=0;i<EVE_SPI_BENCHMARK_BLOCK;i++)
+      {
+      EVE_SPI_Write_8(buffer[i]);
+      }
+    }
+  EVE_SPI_Deselect();
+  DBG_STAT("  byte at a time: %lu bytes/s\n",EVE_SPI_Benchmark_Rate(start_us));
+
+  //Burst from RAM
+  start_us=micros();
+  EVE_SPI_Benchmark_Address(RAM_G_Scratch,EVE_MEM_WRITE);
+  for(block=0;block<EVE_SPI_BENCHMARK_BLOCKS;block++)
+    {
+    EVE_SPI_Write_Burst(buffer,EVE_SPI_BENCHMARK_BLOCK);
+    }
+  EVE_SPI_Deselect();
+  DBG_STAT("  RAM burst:      %lu bytes/s\n",EVE_SPI_Benchmark_Rate(start_us));
+
+  //Burst from flash
+  start_us=micros();
+  EVE_SPI_Benchmark_Address(RAM_G_Scratch,EVE_MEM_WRITE);
+  for(block=0;block<EVE_SPI_BENCHMARK_BLOCKS;block++)
+    {
+    EVE_SPI_Write_Burst_P(EVE_SPI_Benchmark_Pattern,EVE_SPI_BENCHMARK_BLOCK);
+    }
+  EVE_SPI_Deselect();
+  DBG_STAT("  flash burst:    %lu bytes/s\n",EVE_SPI_Benchmark_Rate(start_us));
+
+  //Burst reads. A read ends its transaction, so this one includes the
+  //address and dummy byte for every block, like EVE_Read_Array() does.
+  start_us=micros();
+  for(block=0;block<EVE_SPI_BENCHMARK_BLOCKS;block++)
+    {
+    EVE_SPI_Benchmark_Address(RAM_G_Scratch+(uint32_t)block*EVE_SPI_BENCHMARK_BLOCK,
+                              EVE_MEM_READ);
+    //Dummy byte
+    EVE_SPI_Write_8(0);
+    EVE_SPI_Read_Burst(buffer,EVE_SPI_BENCHMARK_BLOCK);
+    EVE_SPI_Deselect();
+    }
+  DBG_STAT("  read burst:     %lu bytes/s\n",EVE_SPI_Benchmark_Rate(start_us));
+  }
+#endif // (0 != EVE_SPI_BENCHMARK)
+//============================================================================
@@ -0,0 +1,166 @@
+#ifndef __EVE_SPI_H__
+#define __EVE_SPI_H__
+//============================================================================
+//
+// SPI transport for FTDI / BridgeTek EVE graphic accelerators.
+//
+// Everything in EVE_base.cpp and EVE_draw.cpp talks to the EVE through
+// these few calls, so the same code can run against:
+//
+//   EVE_SPI_ARDUINO  the Arduino SPI library and the CS# port macros from
+//                    CFA10099_defines.h (the normal target build)
+//   EVE_SPI_SPIDEV   a Linux /dev/spidevB.C device, for running the
+//                    library on a Raspberry Pi or similar host
+//   EVE_SPI_RECORD   no hardware at all. The traffic is counted and a
+//                    tiny model of the EVE answers the register reads the
+//                    library depends on, so the library can be exercised
+//                    and its SPI traffic profiled on a build host.
+//
+// The transport is picked by EVE_SPI_TRANSPORT in CFA10099_defines.h.
+//
+// Off-target builds put the "host" directory on the include path so that
+// the <Arduino.h> and <SPI.h> includes find the small stand-ins there:
+//
+//   g++ -Ihost -DEVE_SPI_TRANSPORT=EVE_SPI_RECORD -c EVE_spi.cpp EVE_base.cpp EVE_draw.cpp ...
+//
+// host/Makefile does that for the whole sketch, with a driver that prints
+// the SPI traffic of each frame.
+//
+// Crystalfontz America, Inc.
+// https://www.crystalfontz.com/products/eve-accelerated-tft-displays.php
+//===========================================================================
+//This is free and unencumbered software released into the public domain.
+//
+//Anyone is free to copy, modify, publish, use, compile, sell, or
+//distribute this software, either in source code form or as a compiled
+//binary, for any purpose, commercial or non-commercial, and by any
+//means.
+//
+//In jurisdictions that recognize copyright laws, the author or authors
+//of this software dedicate any and all copyright interest in the
+//software to the public domain. We make this dedication for the benefit
+//of the public at large and to the detriment of our heirs and
+//successors. We intend this dedication to be an overt act of
+//relinquishment in perpetuity of all present and future rights to this
+//software under copyright law.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+//EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+//OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+//ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+//OTHER DEALINGS IN THE SOFTWARE.
+//
+//For more information, please refer to <http://unlicense.org/>
+//============================================================================
+// Count the SPI transactions (CS# cycles) and bytes exchanged with the
+// EVE, so the cost of a frame can be measured on the host. Costs a few
+// cycles per transfer, so leave it off unless you are measuring.
+#define EVE_SPI_STATISTICS (0)
+#if (0 != EVE_SPI_STATISTICS)
+extern uint32_t EVE_SPI_Transactions;
+extern uint32_t EVE_SPI_Bytes;
+#define EVE_STAT_TRANSACTION()  (EVE_SPI_Transactions++)
+#define EVE_STAT_BYTES(n)       (EVE_SPI_Bytes+=(n))
+#else
+#define EVE_STAT_TRANSACTION()
+#define EVE_STAT_BYTES(n)
+#endif // (0 != EVE_SPI_STATISTICS)
+// Time each of the SPI transfer paths and print their bytes/second on
+// the debug console from setup(). Debug only.
+#define EVE_SPI_BENCHMARK (0)
+//============================================================================
+// Interface, common to all the transports:
+//
+//   EVE_SPI_Begin()                 get the transport ready, 0 = success
+//   EVE_SPI_Select()                assert CS#, starting a transaction
+//   EVE_SPI_Deselect()              release CS#, ending the transaction
+//   EVE_SPI_Write_8(data)           send one byte
+//   EVE_SPI_Write_Burst(data,n)     send n bytes from RAM
+//   EVE_SPI_Write_Burst_P(data,n)   send n bytes from flash (PROGMEM)
+//   EVE_SPI_Read_Burst(data,n)      clock in n bytes (sending zeros)
+//
+// A transaction is always: select, 3 address bytes, then either the data
+// to write, or a dummy byte followed by one EVE_SPI_Read_Burst() of the
+// data read. Reads are done as a single burst so that transports that
+// cannot return a byte at a time (spidev) can do the whole read in one go.
+//
+// Use the burst calls wherever there is more than one byte to move. On
+// the AVR they keep the SPI shifting back-to-back, loading the next byte
+// while the current one goes out, instead of paying the call and wait
+// overhead of SPI.transfer() for every byte.
+//============================================================================
+#if (EVE_SPI_TRANSPORT == EVE_SPI_ARDUINO)
+// These are trivial, so they are inline to keep the AVR fast.
+inline uint8_t EVE_SPI_Begin(void)
+  {
+  //The sketch's setup() has already called SPI.begin() since the uSD
+  //card shares the bus.
+  return(0);
+  }
+inline void EVE_SPI_Select(void)
+  {
+  CLR_EVE_CS_NOT;
+  EVE_STAT_TRANSACTION();
+  }
+inline void EVE_SPI_Deselect(void)
+  {
+  SET_EVE_CS_NOT;
+  }
+inline void EVE_SPI_Write_8(uint8_t data)
+  {
+  EVE_STAT_BYTES(1);
+  SPI.transfer(data);
+  }
+#else  // (EVE_SPI_TRANSPORT == EVE_SPI_ARDUINO)
+uint8_t EVE_SPI_Begin(void);
+void EVE_SPI_Select(void);
+void EVE_SPI_Deselect(void);
+void EVE_SPI_Write_8(uint8_t data);
+#endif // (EVE_SPI_TRANSPORT == EVE_SPI_ARDUINO)
+void EVE_SPI_Write_Burst(const uint8_t *data, uint16_t length);
+void EVE_SPI_Write_Burst_P(const uint8_t *flash_data, uint16_t length);
+void EVE_SPI_Read_Burst(uint8_t *data, uint16_t length);
+#if (EVE_SPI_TRANSPORT == EVE_SPI_ARDUINO) && !defined(__AVR__)
+// Without the AVR fast path, flash data is copied into a small SRAM
+// window so it can go out with the buffer form of SPI.transfer().
+#define EVE_SPI_WINDOW_SIZE (32)
+#endif // (EVE_SPI_TRANSPORT == EVE_SPI_ARDUINO) && !defined(__AVR__)
+#if (0 != EVE_SPI_BENCHMARK)
+// Scribbles over RAM_G from RAM_G_Scratch, so call it before loading
+// anything there.
+void EVE_SPI_Benchmark(uint32_t RAM_G_Scratch);
+#endif // (0 != EVE_SPI_BENCHMARK)
+//----------------------------------------------------------------------------
+#if (EVE_SPI_TRANSPORT == EVE_SPI_SPIDEV)
+// Which spidev device the EVE is on, and how fast to run it.
+#define EVE_SPIDEV_DEVICE "/dev/spidev0.0"
+#define EVE_SPIDEV_SPEED  (8000000UL)
+#endif // (EVE_SPI_TRANSPORT == EVE_SPI_SPIDEV)
+//----------------------------------------------------------------------------
+#if (EVE_SPI_TRANSPORT == EVE_SPI_RECORD)
+// The recorder keeps totals and a short log of the most recent
+// transactions that a host program can inspect after running some frames.
+typedef struct
+  {
+  // Address + operation flag that started the transaction
+  uint32_t address;
+  // Number of data bytes after the address (and dummy, for reads)
+  uint16_t length;
+  } EVE_SPI_Record_Entry;
+#define EVE_SPI_RECORD_LOG_SIZE (64)
+extern EVE_SPI_Record_Entry EVE_SPI_Record_Log[EVE_SPI_RECORD_LOG_SIZE];
+// Index of the next log entry to be written (wraps)
+extern uint16_t EVE_SPI_Record_Log_Next;
+extern uint32_t EVE_SPI_Record_Transactions;
+extern uint32_t EVE_SPI_Record_Bytes_Written;
+extern uint32_t EVE_SPI_Record_Bytes_Read;
+void EVE_SPI_Record_Clear(void);
+// Called each time the pretend coprocessor runs a CMD_SWAP, if set.
+// loop() never returns, so this is how host/host_main.cpp gets control
+// back once a frame.
+extern void (*EVE_SPI_Record_Swap_Hook)(void);
+#endif // (EVE_SPI_TRANSPORT == EVE_SPI_RECORD)
+//============================================================================
+#endif // __EVE_SPI_H__
@@ -57,8 +57,12 @@
 #endif
 
 #include "EVE_defines.h"
+#include "EVE_spi.h"
 #include "EVE_base.h"
+#include "EVE_ram_g.h"
+#include "EVE_math.h"
 #include "EVE_draw.h"
+#include "EVE_scene.h"
 //Demonstrations of various EVE functions
 #include "demos.h"
 //===========================================================================
@@ -71,11 +75,11 @@ uint16_t Add_Touch_Dot_To_Display_List(uint16_t FWol,
   if(touch_x<1200)
     {
     // Set the variable color of the touched dot to green.
-    FWol=EVE_Cmd_Dat_0(FWol,
-                         EVE_ENC_COLOR_RGB(0x00,0xFF,0x00));
+    FWol=EVE_DL_Dat_0(FWol,
+                        EVE_ENC_COLOR_RGB(0x00,0xFF,0x00));
     // Make it solid
-    FWol=EVE_Cmd_Dat_0(FWol,
-                         EVE_ENC_COLOR_A(0xFF));
+    FWol=EVE_DL_Dat_0(FWol,
+                        EVE_ENC_COLOR_A(0xFF));
 
     // Draw the touch dot -- a 60px point (filled circle)
     FWol=EVE_Point(FWol,
@@ -92,9 +96,12 @@ uint16_t Add_Touch_Dot_To_Display_List(uint16_t FWol,
 //For a static background image, set BMP_SCROLL to 0
 //We will select the file name based on that.
 
-//Address of the 565 bitmap image in RAM_G
-uint32_t
-  Bitmap_RAM_G_Address;
+//Where the 565 bitmap image is in RAM_G, and its CRC
+EVE_RAM_G_Asset
+  Bitmap_Asset=EVE_RAM_G_ASSET_NONE;
+//The bitmap handle it is bound to
+uint8_t
+  Bitmap_Handle=0;
 
 //Keep track of where the background is as it slides around in a loop
 int16_t
@@ -102,15 +109,20 @@ int16_t
 uint8_t
   background_slide_slow;
 //---------------------------------------------------------------------------
-uint16_t Initialize_Bitmap_Demo(uint16_t FWol,
-                                uint32_t *RAM_G_Unused_Start)
+//Load the image, unless it is still in RAM_G from last time.
+static uint16_t Load_Bitmap(uint16_t FWol)
   {
-  //Length of the image in RAM_G
+  //Where the image went in RAM_G, and how long it is
+  uint32_t
+    Bitmap_RAM_G_Address;
   uint32_t
     Bitmap_RAM_G_Length;
-  //Start the slide at position 0.
-  background_slide=0;
-  background_slide_slow=0;
+  FWol=EVE_RAM_G_Asset_Verify(FWol,&Bitmap_Asset);
+  if(EVE_RAM_G_Asset_Is_Loaded(&Bitmap_Asset))
+    {
+    //Still good, and still registered to Bitmap_Handle.
+    return(FWol);
+    }
   //Since the Arduino uSD card is slow, put up a "please wait" screen.
   FWol=Start_Busy_Spinner_Screen(FWol,
                                  //clear color
@@ -119,34 +131,63 @@ uint16_t Initialize_Bitmap_Demo(uint16_t FWol,
                                  EVE_ENC_COLOR_RGB(0xFF,0xFF,0xFF),
                                  //spinner color
                                  EVE_ENC_COLOR_RGB(0x00,0xFF,0x00),
+#if (0 != BMP_INFLATE)
+#if (0 != BMP_SCROLL)
+                                 F("Loading \"CLOUDS.Z\" . . ."));
+#else
+                                 F("Loading \"SPLASH.Z\" . . ."));
+#endif
+#else // (0 != BMP_INFLATE)
 #if (0 != BMP_SCROLL)
                                  F("Loading \"CLOUDS.RAW\" . . ."));
 #else
                                  F("Loading \"SPLASH.RAW\" . . ."));
 #endif
-
-  //Start the slide at position 0.
-  background_slide=0;
-  background_slide_slow=0;
+#endif // (0 != BMP_INFLATE)
 
   //Attempt to load our RAW bitmap file from the uSD into RAM_G
-  Bitmap_RAM_G_Address=*RAM_G_Unused_Start;
   //If the Bitmap_RAM_G_Length returned is 0, then it has probably failed.
-  Bitmap_RAM_G_Length=0;
   //By the way, it appears that the SD library reports all file names
   //in all upper case. So even though Windows file explorer, CMD,
   //and Power Shell all report the name as lower case, we need to
   //feed the SD library an all uppercase string.
-  EVE_Load_File_To_RAM_G(Bitmap_RAM_G_Address,
+#if (0 != BMP_INFLATE)
+  //The .Z is about 40% of the .RAW (uSD_Files/make_z.py), and the
+  //EVE does the unpacking.
+  FWol=EVE_Inflate_File_to_RAM_G(FWol,
 #if (0 != BMP_SCROLL)
-                     "CLOUDS.RAW",
+                                 "CLOUDS.Z",
 #else
-                     "SPLASH.RAW",
+                                 "SPLASH.Z",
 #endif
-                     &Bitmap_RAM_G_Length);
-
-  //Keep track of the RAM_G memory allocation, force to 8-byte aligned
-  *RAM_G_Unused_Start=(*RAM_G_Unused_Start+Bitmap_RAM_G_Length+0x07)&0xFFFFFFF8;
+                                 &Bitmap_RAM_G_Address,
+                                 &Bitmap_RAM_G_Length);
+#else // (0 != BMP_INFLATE)
+  Bitmap_RAM_G_Address=
+    EVE_Load_File_To_RAM_G(
+#if (0 != BMP_SCROLL)
+                           "CLOUDS.RAW",
+#else
+                           "SPLASH.RAW",
+#endif
+                           EVE_RAM_G_ALIGN_FOR_FORMAT(EVE_FORMAT_RGB565),
+                           &Bitmap_RAM_G_Length);
+#endif // (0 != BMP_INFLATE)
+  FWol=EVE_RAM_G_Asset_Loaded(FWol,
+                              &Bitmap_Asset,
+                              Bitmap_RAM_G_Address,
+                              Bitmap_RAM_G_Length);
+  if(EVE_RAM_G_Asset_Is_Loaded(&Bitmap_Asset))
+    {
+    //Set up a bitmap handle for it once, instead of every frame.
+    Bitmap_Handle=EVE_Bitmap_Register(Bitmap_Handle,
+                                      Bitmap_RAM_G_Address,
+                                      EVE_FORMAT_RGB565,
+                                      LCD_WIDTH*2,
+                                      LCD_WIDTH,
+                                      LCD_HEIGHT,
+                                      EVE_FILTER_NEAREST);
+    }
   FWol=Stop_Busy_Spinner_Screen(FWol,
                                 //clear color
                                 EVE_ENC_CLEAR_COLOR_RGB(0x00,0x00,0xFF),
@@ -157,6 +198,14 @@ uint16_t Initialize_Bitmap_Demo(uint16_t FWol,
   return(FWol);
   }
 //---------------------------------------------------------------------------
+uint16_t Initialize_Bitmap_Demo(uint16_t FWol)
+  {
+  //Start the slide at position 0.
+  background_slide=0;
+  background_slide_slow=0;
+  return(Load_Bitmap(FWol));
+  }
+//---------------------------------------------------------------------------
 uint16_t Add_Bitmap_To_Display_List(uint16_t FWol)
   {
   //We have a LCD_WIDTHxLCD_HEIGHT (480x128) tile stored in RAM_G.
@@ -164,6 +213,12 @@ uint16_t Add_Bitmap_To_Display_List(uint16_t FWol)
   //us make a continuous scenery wheel scroll of the background
   int16_t
     tile_offset;
+  //If the load failed (no file, or a corrupt one that made the INFLATE
+  //fault), there is nothing behind Bitmap_Handle to draw.
+  if(!EVE_RAM_G_Asset_Is_Loaded(&Bitmap_Asset))
+    {
+    return(FWol);
+    }
 
 #if (0==BMP_SCROLL) //1 for scroll, 0 for static bitmap
   background_slide=LCD_WIDTH;
@@ -175,58 +230,31 @@ uint16_t Add_Bitmap_To_Display_List(uint16_t FWol)
   tile_offset=background_slide-LCD_WIDTH;
 
   // Set the drawing color to white
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_COLOR_RGB(0xFF,0xFF,0xFF));
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_COLOR_RGB(0xFF,0xFF,0xFF));
   //Solid color -- not transparent
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_COLOR_A(255));
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_COLOR_A(255));
 
-  //First tile: pull the uncompressed RGB565 image from RAM_G onto the screen
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_BEGIN(EVE_BEGIN_BITMAPS));
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_BITMAP_SOURCE(Bitmap_RAM_G_Address));
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_BITMAP_LAYOUT(EVE_FORMAT_RGB565,
-                                           LCD_WIDTH*2,
-                                           LCD_HEIGHT));
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_BITMAP_SIZE(EVE_FILTER_NEAREST,
-                                         EVE_WRAP_BORDER,
-                                         EVE_WRAP_BORDER,
-                                         LCD_WIDTH,
-                                         LCD_HEIGHT));
-  //Render the bitmap it to the current frame
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_VERTEX2F((tile_offset)*16,0*16));
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_END());
+  //First tile: pull the uncompressed RGB565 image from RAM_G onto the
+  //screen. The handle was set up by EVE_Bitmap_Prologue().
+  FWol=EVE_Bitmap_Draw(FWol,Bitmap_Handle,tile_offset,0);
 
 #if (1==BMP_SCROLL) //1 for scroll, 0 for static bitmap
   //Second tile, move over LCD_WIDTH pixels.
   tile_offset+=LCD_WIDTH;
 
   //Pull the uncompressed RGB565 image from RAM_G onto the screen
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_BEGIN(EVE_BEGIN_BITMAPS));
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_BITMAP_SOURCE(Bitmap_RAM_G_Address));
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_BITMAP_LAYOUT(EVE_FORMAT_RGB565,
-                                           LCD_WIDTH*2,
-                                           LCD_HEIGHT));
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_BITMAP_SIZE(EVE_FILTER_NEAREST,
-                                         EVE_WRAP_BORDER,
-                                         EVE_WRAP_BORDER,
-                                         LCD_WIDTH,
-                                         LCD_HEIGHT));
-  //Render the bitmap it to the current frame
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_VERTEX2F((tile_offset)*16,0*16));
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_END());
+  FWol=EVE_Bitmap_Draw(FWol,Bitmap_Handle,tile_offset,0);
+#endif // (1==BMP_SCROLL)
 
+  //Pass our updated offset back to the caller
+  return(FWol);
+  }
+//---------------------------------------------------------------------------
+#if (1==BMP_SCROLL)
+void Scroll_Bitmap(void)
+  {
   //Slide the background along at 1/3 frame rate ~20Hz
   if(0==background_slide_slow)
     {
@@ -244,11 +272,8 @@ uint16_t Add_Bitmap_To_Display_List(uint16_t FWol)
     {
     background_slide_slow--;
     }
-#endif // (1==BMP_SCROLL)
-
-  //Pass our updated offset back to the caller
-  return(FWol);
   }
+#endif // (1==BMP_SCROLL)
 #endif // (0 != BMP_DEMO)
 //===========================================================================
 #if (0 != MARBLE_DEMO)
@@ -265,28 +290,30 @@ int32_t
   marble_rotation;
 int32_t
   marble_spin;
-uint32_t
-  Marble_RAM_G_Address;
+EVE_RAM_G_Asset
+  Marble_Asset=EVE_RAM_G_ASSET_NONE;
 uint32_t
   marble_width;
 uint32_t
   marble_height;
+uint8_t
+  Marble_Handle=0;
 //---------------------------------------------------------------------------
-//Requires uSD
-uint16_t Initialize_Marble_Demo(uint16_t FWol,
-                                uint32_t *RAM_G_Unused_Start)
+//Requires uSD. Loads the image, unless it is still in RAM_G from
+//last time.
+static uint16_t Load_Marble(uint16_t FWol)
   {
-  //Length of the image in RAM_G
+  //Where the image went in RAM_G, and how long it is
+  uint32_t
+    Marble_RAM_G_Address;
   uint32_t
     Marble_RAM_G_Length;
-
-  //Start somewhere reasonable
-  marble_x_pos=LCD_WIDTH*(16/2);
-  marble_x_vel=35;
-  marble_y_pos=LCD_HEIGHT*(16/2);
-  marble_y_vel=-8;
-  marble_rotation=0;
-  marble_spin=0;
+  FWol=EVE_RAM_G_Asset_Verify(FWol,&Marble_Asset);
+  if(EVE_RAM_G_Asset_Is_Loaded(&Marble_Asset))
+    {
+    //Still good, and still registered to Marble_Handle.
+    return(FWol);
+    }
 
   //Since the Arduino uSD card is slow, put up a "please wait" screen.
   FWol=Start_Busy_Spinner_Screen(FWol,
@@ -298,26 +325,35 @@ uint16_t Initialize_Marble_Demo(uint16_t FWol,
                                  EVE_ENC_COLOR_RGB(0x00,0xFF,0x00),
                                  F("Loading \"BLUEMARB.RAW\" . . ."));
 
-  //Attempt to load our RAW bitmap file from the uSD into RAM_G
-  Marble_RAM_G_Address=*RAM_G_Unused_Start;
-
   //You have to know ahead of time how big the image is and what
   //format it is in. EVE_Load_File_To_RAM_G just moves the data.
   marble_width=64;
   marble_height=64;
 
+  //Attempt to load our RAW bitmap file from the uSD into RAM_G
   //If the Marble_RAM_G_Length returned is 0, then it has probably failed.
-  Marble_RAM_G_Length=0;
   //By the way, it appears that the SD library reports all file names
   //in all upper case. So even though Windows file explorer, CMD,
   //and Power Shell all report the name as lower case, we need to
   //feed the SD library an all uppercase string.
-  EVE_Load_File_To_RAM_G(Marble_RAM_G_Address,
-                         "BLUEMARB.RAW",
-                         &Marble_RAM_G_Length);
-
-  //Keep track of the RAM_G memory allocation, force to 8-byte aligned
-  *RAM_G_Unused_Start=(*RAM_G_Unused_Start+Marble_RAM_G_Length+0x07)&0xFFFFFFF8;
+  Marble_RAM_G_Address=
+    EVE_Load_File_To_RAM_G("BLUEMARB.RAW",
+                           EVE_RAM_G_ALIGN_FOR_FORMAT(EVE_FORMAT_ARGB1555),
+                           &Marble_RAM_G_Length);
+  FWol=EVE_RAM_G_Asset_Loaded(FWol,
+                              &Marble_Asset,
+                              Marble_RAM_G_Address,
+                              Marble_RAM_G_Length);
+  if(EVE_RAM_G_Asset_Is_Loaded(&Marble_Asset))
+    {
+    Marble_Handle=EVE_Bitmap_Register(Marble_Handle,
+                                      Marble_RAM_G_Address,
+                                      EVE_FORMAT_ARGB1555,
+                                      marble_width*2,
+                                      marble_width,
+                                      marble_height,
+                                      EVE_FILTER_NEAREST); // EVE_FILTER_BILINEAR, //BiLinear is much more work
+    }
   FWol=Stop_Busy_Spinner_Screen(FWol,
                                 //clear color
                                 EVE_ENC_CLEAR_COLOR_RGB(0x00,0x00,0xFF),
@@ -328,6 +364,18 @@ uint16_t Initialize_Marble_Demo(uint16_t FWol,
   return(FWol);
   }
 //---------------------------------------------------------------------------
+uint16_t Initialize_Marble_Demo(uint16_t FWol)
+  {
+  //Start somewhere reasonable
+  marble_x_pos=LCD_WIDTH*(16/2);
+  marble_x_vel=35;
+  marble_y_pos=LCD_HEIGHT*(16/2);
+  marble_y_vel=-8;
+  marble_rotation=0;
+  marble_spin=0;
+  return(Load_Marble(FWol));
+  }
+//---------------------------------------------------------------------------
 #if TOUCH_DEMO
 void Force_Marble_Position(uint32_t x,uint16_t y)
   {
@@ -338,32 +386,41 @@ void Force_Marble_Position(uint32_t x,uint16_t y)
 //---------------------------------------------------------------------------
 uint16_t Add_Marble_To_Display_List(uint16_t FWol)
   {
+  //If the load failed (no file on the uSD), there is nothing behind
+  //Marble_Handle to draw.
+  if(!EVE_RAM_G_Asset_Is_Loaded(&Marble_Asset))
+    {
+    return(FWol);
+    }
   //========== PUT BLUE MARBLE ON SCREEN ==========
   // Set the drawing color to white
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_COLOR_RGB(0xFF,0xFF,0xFF));
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_COLOR_RGB(0xFF,0xFF,0xFF));
   //Solid color -- not transparent
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_COLOR_A(255));
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_COLOR_A(255));
 
   //Pull the uncompressed bitmap from RAM_G onto the screen
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_BEGIN(EVE_BEGIN_BITMAPS));
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_BITMAP_SOURCE(Marble_RAM_G_Address));
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_BITMAP_LAYOUT(
-                     EVE_FORMAT_ARGB1555,
-                     marble_width*2,
-                     marble_height));
-
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_BITMAP_SIZE(
-                     EVE_FILTER_NEAREST, // EVE_FILTER_BILINEAR, //BiLinear is much more work
-                     EVE_WRAP_BORDER,
-                     EVE_WRAP_BORDER,
-                     marble_width,
-                     marble_height));
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_BEGIN(EVE_BEGIN_BITMAPS));
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_BITMAP_HANDLE(Marble_Handle));
+#if (0 != HOST_BITMAP_TRANSFORM)
+  EVE_Matrix
+    matrix;
+  //Rotate the bitmap about its center, same steps as the coprocessor
+  //version below.
+  EVE_Matrix_Identity(&matrix);
+  EVE_Matrix_Translate(&matrix,
+                       +(to_16_16_fp(marble_width,0)/2),
+                       +(to_16_16_fp(marble_height,0)/2));
+  EVE_Matrix_Rotate(&matrix,
+                    EVE_DEGREES(marble_rotation));
+  EVE_Matrix_Translate(&matrix,
+                       -(to_16_16_fp(marble_width,0)/2),
+                       -(to_16_16_fp(marble_height,0)/2));
+  FWol=EVE_Bitmap_Transform(FWol,&matrix);
+#else // (0 != HOST_BITMAP_TRANSFORM)
    //Rotate the bitmap
   FWol=EVE_Cmd_Dat_0(FWol,
                      EVE_ENC_CMD_LOADIDENTITY);
@@ -383,20 +440,25 @@ uint16_t Add_Marble_To_Display_List(uint16_t FWol)
                      -(to_16_16_fp(marble_height,0)/2));
   FWol=EVE_Cmd_Dat_0(FWol,
                      EVE_ENC_CMD_SETMATRIX);
+#endif // (0 != HOST_BITMAP_TRANSFORM)
   //Render the bitmap it to the current frame
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_VERTEX2F(
-                       (marble_x_pos-(marble_width*(16/2))),
-                       (marble_y_pos-(marble_height*(16/2)))));
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_END());
+  FWol=EVE_Vertex_16(FWol,
+                     (marble_x_pos-(marble_width*(16/2))),
+                     (marble_y_pos-(marble_height*(16/2))));
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_END());
 
   //Reset the matrix . . otherwise further things (like text) in this
   //display list will be goofed.
+#if (0 != HOST_BITMAP_TRANSFORM)
+  EVE_Matrix_Identity(&matrix);
+  FWol=EVE_Bitmap_Transform(FWol,&matrix);
+#else // (0 != HOST_BITMAP_TRANSFORM)
   FWol=EVE_Cmd_Dat_0(FWol,
                      EVE_ENC_CMD_LOADIDENTITY);
   FWol=EVE_Cmd_Dat_0(FWol,
                      EVE_ENC_CMD_SETMATRIX);
+#endif // (0 != HOST_BITMAP_TRANSFORM)
 
   return(FWol);
   }
@@ -550,11 +612,11 @@ void Initialize_Bounce_Demo(void)
 uint16_t Add_Bounce_To_Display_List(uint16_t FWol)
   {
   // Set the variable color of the bouncing ball
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_COLOR_RGB(r,g,b));
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_COLOR_RGB(r,g,b));
   // Make it transparent
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_COLOR_A(transparency));
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_COLOR_A(transparency));
 
   // Draw the ball -- a point (filled circle)
   FWol=EVE_Point(FWol,
@@ -587,8 +649,8 @@ uint16_t Add_Bounce_To_Display_List(uint16_t FWol)
     rubberband_width=1;
 
   //Now that we know the rubberband width, drawing it is simple.
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_COLOR_RGB(200,0,0));
+  FWol=EVE_DL_Dat_0(FWol,
+                    EVE_ENC_COLOR_RGB(200,0,0));
   //(transparency set above still in effect)
   FWol=EVE_Line(FWol,
                 LCD_WIDTH/2,LCD_HEIGHT/2,
@@ -747,18 +809,24 @@ void Bounce_Ball(void)
 #endif // (0 != BOUNCE_DEMO)
 //============================================================================
 #if (0 != LOGO_DEMO)
-//Remember where we put the logo image data in RAM_G
-uint32_t
-  Logo_RAM_G_Address;
+//The bitmap handle the logo is bound to
+uint8_t
+  Logo_Handle=0;
+//Remember where we put the logo image data in RAM_G, and its CRC
+EVE_RAM_G_Asset
+  Logo_Asset=EVE_RAM_G_ASSET_NONE;
 //Remember how big the Logo image is.
 uint32_t
   Logo_Width;
 uint32_t
   Logo_Height;
 
-// Keep track of the logo's orientation
+// Keep track of the logo's orientation, in CMD_ROTATE units
 uint16_t
-  logo_rotate_degrees;
+  logo_angle;
+//Eases the logo through each full turn
+EVE_Animation
+  logo_spin;
 //Used to pause the logo between spinning sesions
 uint16_t
   logo_rotate_pause;
@@ -770,16 +838,26 @@ uint8_t
  first=0;
 #endif // (0!=DEBUG_COPROCESSOR_RESET)
 
-uint16_t Initialize_Logo_Demo(uint16_t FWol,
-                              uint32_t *RAM_G_Unused_Start)
+//Load the logo, unless it is still in RAM_G from last time.
+static uint16_t Load_Logo(uint16_t FWol)
   {
-  // No rotation to start.
-  logo_rotate_degrees=0;
-  // Don't spin the logo right away, delay ~8 seconds at 60 frames per second
-  logo_rotate_pause=8*60;
+  //Where the logo went in RAM_G
+  uint32_t
+    Logo_RAM_G_Address;
+#if (0 != DEBUG_COPROCESSOR_RESET)
+  //The point is to run the (alternately bad) inflate, so always
+  //replace the old one.
+  EVE_RAM_G_Asset_Release(&Logo_Asset);
+#endif // (0 != DEBUG_COPROCESSOR_RESET)
+  FWol=EVE_RAM_G_Asset_Verify(FWol,&Logo_Asset);
+  if(EVE_RAM_G_Asset_Is_Loaded(&Logo_Asset))
+    {
+    //Still good, and still registered to Logo_Handle.
+    return(FWol);
+    }
 
-  //Remember where we put the logo in RAM_G so we can access it later.
-  Logo_RAM_G_Address=*RAM_G_Unused_Start;
+  //The loaders below remember where they put the logo in RAM_G, so we
+  //can access it later.
 #if (0==LOGO_PNG_0_ARGB2_1)
   //Load and expand our 24-bit PNG (true color, lossless, with
   //transparency) into RAM_G
@@ -788,7 +866,7 @@ uint16_t Initialize_Logo_Demo(uint16_t FWol,
   FWol=EVE_Load_PNG_to_RAM_G(FWol,
                              CFA480128Ex_039Tx_PNG_LOGO,
                              LOGO_SIZE_PNG,
-                             RAM_G_Unused_Start,
+                             &Logo_RAM_G_Address,
                              &Logo_Width,
                              &Logo_Height);
 #endif // 0==LOGO_PNG_0_ARGB2_1
@@ -811,7 +889,7 @@ uint16_t Initialize_Logo_Demo(uint16_t FWol,
     FWol=EVE_Inflate_to_RAM_G(FWol,
                               CFA480128Ex_039Tx_ARGB2_LOGO,
                               LOGO_SIZE_ARGB2,
-                              RAM_G_Unused_Start);
+                              &Logo_RAM_G_Address);
     DBG_GEEK("Good inflate\n");
     first=1;
     }
@@ -821,7 +899,7 @@ uint16_t Initialize_Logo_Demo(uint16_t FWol,
     FWol=EVE_Inflate_to_RAM_G(FWol,
                               CFA480128Ex_039Tx_ARGB2_LOGO+20,
                               LOGO_SIZE_ARGB2,
-                              RAM_G_Unused_Start);
+                              &Logo_RAM_G_Address);
     DBG_GEEK("Bad inflate\n");
     first=0;
     }
@@ -830,45 +908,88 @@ uint16_t Initialize_Logo_Demo(uint16_t FWol,
   FWol=EVE_Inflate_to_RAM_G(FWol,
                             CFA480128Ex_039Tx_ARGB2_LOGO,
                             LOGO_SIZE_ARGB2,
-                            RAM_G_Unused_Start);
+                            &Logo_RAM_G_Address);
 
 #endif //(0!=DEBUG_COPROCESSOR_RESET)
                               
 #endif // 1==LOGO_PNG_0_ARGB2_1
+  if(EVE_RAM_G_NONE == Logo_RAM_G_Address)
+    {
+    //Nothing to show.
+    return(FWol);
+    }
+  FWol=EVE_RAM_G_Asset_Loaded(FWol,
+                              &Logo_Asset,
+                              Logo_RAM_G_Address,
+#if (0==LOGO_PNG_0_ARGB2_1)
+                              Logo_Width*Logo_Height*2);
+#else // (0==LOGO_PNG_0_ARGB2_1)
+                              Logo_Width*Logo_Height);
+#endif // (0==LOGO_PNG_0_ARGB2_1)
+  //In order to have a 240x240 logo rotate without clipping, we have
+  //a 240*sqrt(2) x 240*sqrt(2) = 340 x 340 logo, with all the non
+  //transparent content kept inside a 240 circle. Whatevs.
+  Logo_Handle=EVE_Bitmap_Register(Logo_Handle,
+                                  Logo_RAM_G_Address,
+#if (0==LOGO_PNG_0_ARGB2_1)
+                                  //Transparent PNG comes in as ARGB4,
+                                  //2 bytes per pixel
+                                  EVE_FORMAT_ARGB4,
+                                  Logo_Width*2,
+#else // (0==LOGO_PNG_0_ARGB2_1)
+                                  //ARGB2 is 1 byte per pixel
+                                  EVE_FORMAT_ARGB2,
+                                  Logo_Width,
+#endif // (0==LOGO_PNG_0_ARGB2_1)
+                                  Logo_Width,
+                                  Logo_Height,
+                                  EVE_FILTER_BILINEAR);
   //Pass our updated offset back to the caller
   return(FWol);
   }
 //----------------------------------------------------------------------------
+uint16_t Initialize_Logo_Demo(uint16_t FWol)
+  {
+  // No rotation to start.
+  logo_angle=0;
+  EVE_Animation_Start(&logo_spin,0,0,0,EVE_EASE_LINEAR);
+  // Don't spin the logo right away, delay ~8 seconds at 60 frames per second
+  logo_rotate_pause=8*60;
+  return(Load_Logo(FWol));
+  }
+//----------------------------------------------------------------------------
 uint16_t Add_Logo_To_Display_List(uint16_t FWol)
   {
+  //If the load failed (say the INFLATE faulted), there is nothing behind
+  //Logo_Handle to draw.
+  if(!EVE_RAM_G_Asset_Is_Loaded(&Logo_Asset))
+    {
+    return(FWol);
+    }
   //========== PUT LOGO ON SCREEN ==========
   // Set the drawing color to white
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_COLOR_RGB(0xFF,0xFF,0xFF));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_COLOR_RGB(0xFF,0xFF,0xFF));
   //Solid color -- not transparent
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_COLOR_A(255));
-  //Point to the uncompressed logo in RAM_G
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_BEGIN(EVE_BEGIN_BITMAPS));
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_BITMAP_SOURCE(Logo_RAM_G_Address));
-
-#if 0==LOGO_PNG_0_ARGB2_1
-  //Transparent PNG comes in as ARGB4, 2 bytes per pixel
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_BITMAP_LAYOUT(EVE_FORMAT_ARGB4,Logo_Width*2,Logo_Height));
-#endif // 0==LOGO_PNG_0_ARGB2_1
-
-#if 1==LOGO_PNG_0_ARGB2_1
-  //ARGB2 comes in as EVE_FORMAT_ARGB2, 1 byte per pixel
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_BITMAP_LAYOUT(EVE_FORMAT_ARGB2,Logo_Width,Logo_Height));
-#endif // 1==LOGO_PNG_0_ARGB2_1
-
-  //In order to have a 240x240 logo rotate without clipping, we have
-  //a 240*sqrt(2) x 240*sqrt(2) = 340 x 340 logo, with all the non
-  //transparent content kept inside a 240 circle. Whatevs.
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_BITMAP_SIZE(EVE_FILTER_BILINEAR,
-					                     EVE_WRAP_BORDER,
-										 EVE_WRAP_BORDER,
-										 Logo_Width,
-										 Logo_Height));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_COLOR_A(255));
+  //Draw the logo, its handle was set up by EVE_Bitmap_Prologue()
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BEGIN(EVE_BEGIN_BITMAPS));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_BITMAP_HANDLE(Logo_Handle));
+#if (0 != HOST_BITMAP_TRANSFORM)
+  EVE_Matrix
+    matrix;
+  //Rotate about the center of the logo. Upright this comes out as the
+  //identity, which the state tracker leaves out altogether.
+  EVE_Matrix_Identity(&matrix);
+  EVE_Matrix_Translate(&matrix,
+                       to_16_16_fp(Logo_Width,0)/2,
+                       to_16_16_fp(Logo_Height,0)/2);
+  EVE_Matrix_Rotate(&matrix,
+                    logo_angle);
+  EVE_Matrix_Translate(&matrix,
+                       -(to_16_16_fp(Logo_Width,0)/2),
+                       -(to_16_16_fp(Logo_Height,0)/2));
+  FWol=EVE_Bitmap_Transform(FWol,&matrix);
+#else // (0 != HOST_BITMAP_TRANSFORM)
    //Rotate the bitmap
   FWol=EVE_Cmd_Dat_0(FWol,
                      EVE_ENC_CMD_LOADIDENTITY);
@@ -880,52 +1001,55 @@ uint16_t Add_Logo_To_Display_List(uint16_t FWol)
   //The actual rotate command
   FWol=EVE_Cmd_Dat_1(FWol,
                      EVE_ENC_CMD_ROTATE,
-                     to_16_16_fp(logo_rotate_degrees,0)/360);
+                     logo_angle);
   //Undo the translation, and move to the center of the screen.
   FWol=EVE_Cmd_Dat_2(FWol,EVE_ENC_CMD_TRANSLATE,
                      (to_16_16_fp(-Logo_Width/2+0/2,0)),
                      (to_16_16_fp(-Logo_Height/2+0/2,0)));
   FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_CMD_SETMATRIX);
+#endif // (0 != HOST_BITMAP_TRANSFORM)
   //Render the bitmap to the current frame
-  FWol=EVE_Cmd_Dat_0(FWol,
-                     EVE_ENC_VERTEX2F((LCD_WIDTH-Logo_Width)*(16/2),
-					                  (LCD_HEIGHT-Logo_Height)*(16/2)));
-  FWol=EVE_Cmd_Dat_0(FWol, EVE_ENC_END());
-
+  FWol=EVE_Vertex_16(FWol,
+                     (LCD_WIDTH-Logo_Width)*(16/2),
+                     (LCD_HEIGHT-Logo_Height)*(16/2));
+  FWol=EVE_DL_Dat_0(FWol, EVE_ENC_END());
+  //Pass our updated offset back to the caller
+  return(FWol);
+  }
+//----------------------------------------------------------------------------
+void Spin_Logo(void)
+  {
   // ROTATE THE LOGO -- MAINLY BECAUSE WE CAN.
-  if(0 == logo_rotate_degrees)
+  if(!EVE_Animation_Done(&logo_spin))
     {
-    //upright, stay here for logo_rotate_pause frames
-    if(0 != logo_rotate_pause)
-      {
-      logo_rotate_pause--;
-      }
-    else
+    //One full turn, which wraps the angle back to upright at the end.
+    logo_angle=(uint16_t)EVE_Animation_Step(&logo_spin);
+    if(EVE_Animation_Done(&logo_spin))
       {
       // ~ 7 seconds at 60 frames per second
       logo_rotate_pause=7*60;
-      logo_rotate_degrees=1;
       }
     }
   else
     {
-    if(logo_rotate_degrees<359)
-      logo_rotate_degrees++;
+    //upright, stay here for logo_rotate_pause frames
+    if(0 != logo_rotate_pause)
+      {
+      logo_rotate_pause--;
+      }
     else
-      logo_rotate_degrees=0;
+      {
+      //Spin up and back down over ~6 seconds
+      EVE_Animation_Start(&logo_spin,0,65536,360,EVE_EASE_SINE);
+      }
     }
-  //Pass our updated offset back to the caller
-  return(FWol);
   }
 #endif // (0 != LOGO_DEMO)
 //============================================================================
 #if (0 != SOUND_DEMO)
-//Remember where we put the audio data in RAM_G
-uint32_t
-  Audio_RAM_G_Address;
-//Remember how big the audio data is.
-uint32_t
-  Audio_RAM_G_Length;
+//Remember where we put the audio data in RAM_G, how big it is and its CRC
+EVE_RAM_G_Asset
+  Audio_Asset=EVE_RAM_G_ASSET_NONE;
 //Keep track of how many times we have played the sound.
 uint8_t
   play_times;
@@ -936,9 +1060,19 @@ uint16_t
 uint16_t
   sound_logo_rotate_pause;
 //----------------------------------------------------------------------------
-uint16_t Initialize_Sound_Demo(uint16_t FWol,
-                               uint32_t *RAM_G_Unused_Start)
+//Load the sound, unless it is still in RAM_G from last time.
+static uint16_t Load_Sound(uint16_t FWol)
   {
+  //Where the sound went in RAM_G, and how long it is
+  uint32_t
+    Audio_RAM_G_Address;
+  uint32_t
+    Audio_RAM_G_Length;
+  FWol=EVE_RAM_G_Asset_Verify(FWol,&Audio_Asset);
+  if(EVE_RAM_G_Asset_Is_Loaded(&Audio_Asset))
+    {
+    return(FWol);
+    }
   //Since the Arduino uSD card is slow, put up a please wait screen.
   FWol=Start_Busy_Spinner_Screen(FWol,
                                  //clear color
@@ -953,16 +1087,7 @@ uint16_t Initialize_Sound_Demo(uint16_t FWol,
                                  F("Loading \"MUS_8K.RAW\" . . ."));
 #endif
 
-  //Play the sound the number of times the user requested.
-  play_times=SOUND_PLAY_TIMES;
-  // Sync the sound start with the logo rotating
-  sound_logo_rotate_degrees=0;
-  sound_logo_rotate_pause=8*60;
-
   //Attempt to load our RAW audio file from the uSD into RAM_G
-  Audio_RAM_G_Address=*RAM_G_Unused_Start;
-  Audio_RAM_G_Length=0;
-
   //If the Audio_RAM_G_Length returned is 0, then it has probably failed.
   //Not much to do in the way of error recovery though, as the EVE
   //would just be instructed to play a 0-lenght RAM_G buffer, which
@@ -971,21 +1096,35 @@ uint16_t Initialize_Sound_Demo(uint16_t FWol,
   //in all upper case. So even though Windows file explorer, CMD,
   //and Power Shell all report the name as lower case, we need to
   //feed the SD library an all uppercase string.
-  EVE_Load_File_To_RAM_G(Audio_RAM_G_Address,
+  //REG_PLAYBACK_START has to be 8-byte aligned.
+  Audio_RAM_G_Address=
+    EVE_Load_File_To_RAM_G(
 #if (0 != SOUND_VOICE)
-                         "VOI_8K.RAW",
+                           "VOI_8K.RAW",
 #else
-                         "MUS_8K.RAW",
+                           "MUS_8K.RAW",
 #endif
-                         &Audio_RAM_G_Length);
-
-  //Keep track of the RAM_G memory allocation, force to 8-byte aligned
-  *RAM_G_Unused_Start=(*RAM_G_Unused_Start+Audio_RAM_G_Length+0x07)&0xFFFFFFF8;
+                           EVE_RAM_G_ALIGN_AUDIO,
+                           &Audio_RAM_G_Length);
+  FWol=EVE_RAM_G_Asset_Loaded(FWol,
+                              &Audio_Asset,
+                              Audio_RAM_G_Address,
+                              Audio_RAM_G_Length);
 
   //Pass our updated offset back to the caller
   return(FWol);
   }
 //----------------------------------------------------------------------------
+uint16_t Initialize_Sound_Demo(uint16_t FWol)
+  {
+  //Play the sound the number of times the user requested.
+  play_times=SOUND_PLAY_TIMES;
+  // Sync the sound start with the logo rotating
+  sound_logo_rotate_degrees=0;
+  sound_logo_rotate_pause=8*60;
+  return(Load_Sound(FWol));
+  }
+//----------------------------------------------------------------------------
 void Start_Sound_Demo_Playing(void)
   {
 //  if(1 == sound_logo_rotate_degrees)
@@ -1006,8 +1145,8 @@ void Start_Sound_Demo_Playing(void)
 #endif
 #if 1 //Audio file
         //Point the EVE audio stuff at our RAM_G audio data. Let it go.
-        EVE_REG_Write_32(REG_PLAYBACK_START,Audio_RAM_G_Address);
-        EVE_REG_Write_32(REG_PLAYBACK_LENGTH,Audio_RAM_G_Length);
+        EVE_REG_Write_32(REG_PLAYBACK_START,Audio_Asset.address);
+        EVE_REG_Write_32(REG_PLAYBACK_LENGTH,Audio_Asset.length);
         EVE_REG_Write_32(REG_PLAYBACK_FREQ,8000);
         EVE_REG_Write_32(REG_PLAYBACK_FORMAT,ULAW_SAMPLES);
         EVE_REG_Write_32(EVE_REG_VOL_PB,0);
@@ -1060,6 +1199,112 @@ void Start_Sound_Demo_Playing(void)
   }
 #endif // (0 != SOUND_DEMO)
 //============================================================================
+// After Reset_EVE_Coprocessor(): check each demo's RAM_G against the CRC
+// taken when it was loaded, and load only the ones that changed. Their
+// addresses may move, so anything that recorded them (Static_DL) has to
+// be recorded again.
+uint16_t Reload_Demo_Assets(uint16_t FWol)
+  {
+#if (0 != LOGO_DEMO)
+  FWol=Load_Logo(FWol);
+#endif // (0 != LOGO_DEMO)
+#if (0 != BMP_DEMO)
+  FWol=Load_Bitmap(FWol);
+#endif // (0 != BMP_DEMO)
+#if (0 != SOUND_DEMO)
+  FWol=Load_Sound(FWol);
+#endif // (0 != SOUND_DEMO)
+#if (0 != MARBLE_DEMO)
+  FWol=Load_Marble(FWol);
+#endif // (0 != MARBLE_DEMO)
+  return(FWol);
+  }
+//============================================================================
+#if (0 != SCENE_DEMO)
+// A mostly static screen built as a retained scene: the panel is recorded
+// into RAM_G once, and a frame is only sent when the counter or the
+// blinking light changes, about twice a second.
+EVE_Scene_Node
+  scene_root;
+EVE_Scene_Node
+  scene_panel;
+EVE_Scene_Node
+  scene_background;
+EVE_Scene_Node
+  scene_title;
+EVE_Scene_Node
+  scene_frame;
+EVE_Scene_Node
+  scene_seconds;
+EVE_Scene_Node
+  scene_light;
+EVE_DL_Cache
+  scene_panel_cache;
+// An outline around the counter, two corners per rectangle
+static const int16_t
+  scene_frame_xy[4]={LCD_WIDTH/2-90,LCD_HEIGHT/2-30,
+                     LCD_WIDTH/2+90,LCD_HEIGHT/2+30};
+uint16_t
+  scene_loops;
+uint16_t
+  scene_frames;
+//----------------------------------------------------------------------------
+void Initialize_Scene_Demo(void)
+  {
+  EVE_DL_Cache_Initialize(&scene_panel_cache,SCENE_PANEL_CACHE_SIZE);
+
+  EVE_Scene_Group(&scene_root,0,0,0);
+  //Everything that never changes goes in the cached panel.
+  EVE_Scene_Group(&scene_panel,0,0,&scene_panel_cache);
+  EVE_Scene_Add(&scene_root,&scene_panel);
+  EVE_Scene_Rect(&scene_background,0,0,LCD_WIDTH-1,LCD_HEIGHT-1,
+                 EVE_ENC_COLOR_RGB(0x20,0x20,0x40));
+  EVE_Scene_Add(&scene_panel,&scene_background);
+  EVE_Scene_Text(&scene_title,10,LCD_HEIGHT/2,28,EVE_OPT_CENTERY,
+                 F("Uptime"),EVE_ENC_COLOR_RGB(0xFF,0xFF,0xFF));
+  EVE_Scene_Add(&scene_panel,&scene_title);
+  EVE_Scene_Batch(&scene_frame,EVE_BEGIN_RECTS,scene_frame_xy,1,16*8,
+                  EVE_ENC_COLOR_RGB(0x40,0x40,0x80));
+  EVE_Scene_Add(&scene_panel,&scene_frame);
+  //The parts that change are drawn every frame.
+  EVE_Scene_Number(&scene_seconds,LCD_WIDTH/2,LCD_HEIGHT/2,31,
+                   EVE_OPT_CENTER,0,EVE_ENC_COLOR_RGB(0xFF,0xFF,0x00));
+  EVE_Scene_Add(&scene_root,&scene_seconds);
+  EVE_Scene_Rect(&scene_light,LCD_WIDTH-40,LCD_HEIGHT/2-10,
+                 LCD_WIDTH-20,LCD_HEIGHT/2+10,
+                 EVE_ENC_COLOR_RGB(0x00,0xFF,0x00));
+  EVE_Scene_Add(&scene_root,&scene_light);
+
+  scene_loops=0;
+  scene_frames=0;
+  }
+//----------------------------------------------------------------------------
+uint16_t Update_Scene_Demo(uint16_t FWol)
+  {
+  uint32_t
+    now;
+  now=millis();
+  //These only mark the scene dirty when the value really changes.
+  EVE_Scene_Set_Number(&scene_seconds,now/1000);
+  EVE_Scene_Set_Color(&scene_light,
+                      (now&0x200)?EVE_ENC_COLOR_RGB(0x00,0xFF,0x00):
+                                  EVE_ENC_COLOR_RGB(0x00,0x40,0x00));
+  if(EVE_Scene_Changed(&scene_root))
+    {
+    scene_frames++;
+    }
+  FWol=EVE_Scene_Frame(FWol,&scene_root,EVE_ENC_CLEAR_COLOR_RGB(0,0,0));
+  scene_loops++;
+  if(0 == (scene_loops&0x3FFF))
+    {
+    DBG_STAT("Scene: %u frames sent in %u passes\n",scene_frames,scene_loops);
+    scene_loops=0;
+    scene_frames=0;
+    }
+  return(FWol);
+  }
+#endif // (0 != SCENE_DEMO)
+//============================================================================
 #if (0 != MANUAL_BACKLIGHT_DEBUG)
 // Changes backlight from 0 to 128 over 5% to 95% of axis
 uint16_t Set_Backlight_From_Touch(uint16_t FWol,
@@ -1084,11 +1329,11 @@ uint16_t Set_Backlight_From_Touch(uint16_t FWol,
   DBG_GEEK("BL Set to: %3d\n",BL_Val);
   //Write to the LCD
   //Solid text
-  FWol=EVE_Cmd_Dat_0(FWol,
-                       EVE_ENC_COLOR_A(0xFF));
+  FWol=EVE_DL_Dat_0(FWol,
+                      EVE_ENC_COLOR_A(0xFF));
   // Make it Green
-  FWol=EVE_Cmd_Dat_0(FWol,
-                       EVE_ENC_COLOR_RGB(0x80,0x80,0xFF));
+  FWol=EVE_DL_Dat_0(FWol,
+                      EVE_ENC_COLOR_RGB(0x80,0x80,0xFF));
   //Put the backlight value on the screen
   FWol=EVE_PrintF(FWol,
                   10,
@@ -39,14 +39,15 @@ uint16_t Add_Touch_Dot_To_Display_List(uint16_t FWol,
 #endif //(0 != TOUCH_DEMO)
 //----------------------------------------------------------------------------
 #if (0 != BMP_DEMO)
-uint16_t Initialize_Bitmap_Demo(uint16_t FWol,
-                                uint32_t *RAM_G_Unused_Start);
+uint16_t Initialize_Bitmap_Demo(uint16_t FWol);
 uint16_t Add_Bitmap_To_Display_List(uint16_t FWol);
+#if (1==BMP_SCROLL)
+void Scroll_Bitmap(void);
+#endif // (1==BMP_SCROLL)
 #endif // (0 != BMP_DEMO)
 //----------------------------------------------------------------------------
 #if (0 != MARBLE_DEMO) //Requires uSD
-uint16_t Initialize_Marble_Demo(uint16_t FWol,
-                                uint32_t *RAM_G_Unused_Start);
+uint16_t Initialize_Marble_Demo(uint16_t FWol);
 #if (0 != TOUCH_DEMO)
 void Force_Marble_Position(uint32_t x,uint16_t y);
 #endif //(0 != TOUCH_DEMO)
@@ -61,16 +62,109 @@ void Bounce_Ball(void);
 #endif // (0 != BOUNCE_DEMO)
 //----------------------------------------------------------------------------
 #if (0 != LOGO_DEMO)
-uint16_t Initialize_Logo_Demo(uint16_t FWol,
-                              uint32_t *RAM_G_Unused_Start);
+uint16_t Initialize_Logo_Demo(uint16_t FWol);
 uint16_t Add_Logo_To_Display_List(uint16_t FWol);
+void Spin_Logo(void);
 #endif // (0 != LOGO_DEMO)
 //----------------------------------------------------------------------------
 #if (0 != SOUND_DEMO)
-uint16_t Initialize_Sound_Demo(uint16_t FWol,
-                               uint32_t *RAM_G_Unused_Start);
+uint16_t Initialize_Sound_Demo(uint16_t FWol);
 void Start_Sound_Demo_Playing(void);
 #endif // (0 != SOUND_DEMO)
+//----------------------------------------------------------------------------
+#if (0 != SCENE_DEMO)
+void Initialize_Scene_Demo(void);
+uint16_t Update_Scene_Demo(uint16_t FWol);
+#endif // (0 != SCENE_DEMO)
+//----------------------------------------------------------------------------
+uint16_t Reload_Demo_Assets(uint16_t FWol);
+//============================================================================
+// RAM_G budget: what the enabled demos load, and where EVE_RAM_G_Alloc()
+// puts it when loop() loads them in order into an empty RAM_G. A set of
+// demos that can not all fit is an error right here, instead of an image
+// missing at runtime. The sizes of the files in uSD_Files are copied by
+// hand, keep them up to date.
+#define RAM_G_SIZE_CLOUDS_RAW   (153600UL)
+#define RAM_G_SIZE_SPLASH_RAW   (153600UL)
+#define RAM_G_SIZE_BLUEMARB_RAW (18432UL)
+#define RAM_G_SIZE_MUS_8K_RAW   (35088UL)
+#define RAM_G_SIZE_VOI_8K_RAW   (88336UL)
+// The logo is 340x340 once expanded, ARGB2 (1 byte per pixel) or ARGB4
+// from the PNG (2 bytes per pixel).
+#define RAM_G_SIZE_LOGO_ARGB2   (340UL*340UL)
+#define RAM_G_SIZE_LOGO_PNG     (340UL*340UL*2)
+#define SCENE_PANEL_CACHE_SIZE  (128)
+// The allocator's rounding: start aligned, length in whole words.
+#define RAM_G_ALIGN(address,alignment) \
+  (((address)+((alignment)-1))&~((alignment)-1UL))
+#define RAM_G_WORDS(length)     (((length)+3)&~3UL)
+#define RAM_G_PLACE(after,length,alignment) \
+  (RAM_G_ALIGN(after,alignment)+RAM_G_WORDS(length))
+//----------------------------------------------------------------------------
+#if (0 != LOGO_DEMO)
+#if (1 == LOGO_PNG_0_ARGB2_1)
+#define RAM_G_END_LOGO   RAM_G_PLACE(EVE_RAM_G,RAM_G_SIZE_LOGO_ARGB2,4)
+#else
+#define RAM_G_END_LOGO   RAM_G_PLACE(EVE_RAM_G,RAM_G_SIZE_LOGO_PNG,4)
+#endif // (1 == LOGO_PNG_0_ARGB2_1)
+#define RAM_G_BLOCKS_LOGO (1)
+#else
+#define RAM_G_END_LOGO   (EVE_RAM_G)
+#define RAM_G_BLOCKS_LOGO (0)
+#endif // (0 != LOGO_DEMO)
+
+#if (0 != BMP_DEMO)
+#if (0 != BMP_SCROLL)
+#define RAM_G_END_BMP    RAM_G_PLACE(RAM_G_END_LOGO,RAM_G_SIZE_CLOUDS_RAW,4)
+#else
+#define RAM_G_END_BMP    RAM_G_PLACE(RAM_G_END_LOGO,RAM_G_SIZE_SPLASH_RAW,4)
+#endif // (0 != BMP_SCROLL)
+#define RAM_G_BLOCKS_BMP (1)
+#else
+#define RAM_G_END_BMP    RAM_G_END_LOGO
+#define RAM_G_BLOCKS_BMP (0)
+#endif // (0 != BMP_DEMO)
+
+#if (0 != SOUND_DEMO)
+#if (0 != SOUND_VOICE)
+#define RAM_G_END_SOUND  RAM_G_PLACE(RAM_G_END_BMP,RAM_G_SIZE_VOI_8K_RAW,8)
+#else
+#define RAM_G_END_SOUND  RAM_G_PLACE(RAM_G_END_BMP,RAM_G_SIZE_MUS_8K_RAW,8)
+#endif // (0 != SOUND_VOICE)
+#define RAM_G_BLOCKS_SOUND (1)
+#else
+#define RAM_G_END_SOUND  RAM_G_END_BMP
+#define RAM_G_BLOCKS_SOUND (0)
+#endif // (0 != SOUND_DEMO)
+
+#if (0 != MARBLE_DEMO)
+#define RAM_G_END_MARBLE RAM_G_PLACE(RAM_G_END_SOUND,RAM_G_SIZE_BLUEMARB_RAW,4)
+#define RAM_G_BLOCKS_MARBLE (1)
+#else
+#define RAM_G_END_MARBLE RAM_G_END_SOUND
+#define RAM_G_BLOCKS_MARBLE (0)
+#endif // (0 != MARBLE_DEMO)
+
+// Last come the display list caches. The scene demo never returns, so it
+// is one or the other.
+#if (0 != SCENE_DEMO)
+#define RAM_G_END        RAM_G_PLACE(RAM_G_END_MARBLE,SCENE_PANEL_CACHE_SIZE,4)
+#define RAM_G_BLOCKS_DL  (1)
+#elif (0 != STATIC_DL_CACHE)
+#define RAM_G_END        RAM_G_PLACE(RAM_G_END_MARBLE,STATIC_DL_CACHE_SIZE,4)
+#define RAM_G_BLOCKS_DL  (1)
+#else
+#define RAM_G_END        RAM_G_END_MARBLE
+#define RAM_G_BLOCKS_DL  (0)
+#endif // (0 != SCENE_DEMO)
+
+#if ((EVE_RAM_G+EVE_RAM_G_SIZE) < RAM_G_END)
+#error RAM_G budget: the demos enabled in CFA10099_defines.h need more RAM_G than this EVE_DEVICE has.
+#endif // ((EVE_RAM_G+EVE_RAM_G_SIZE) < RAM_G_END)
+#if (EVE_RAM_G_BLOCKS < (RAM_G_BLOCKS_LOGO+RAM_G_BLOCKS_BMP+RAM_G_BLOCKS_SOUND+ \
+                         RAM_G_BLOCKS_MARBLE+RAM_G_BLOCKS_DL))
+#error RAM_G budget: the demos enabled in CFA10099_defines.h need more blocks than EVE_RAM_G_BLOCKS.
+#endif
 //============================================================================
 #if (0 != MANUAL_BACKLIGHT_DEBUG)
 uint16_t Set_Backlight_From_Touch(uint16_t FWol,
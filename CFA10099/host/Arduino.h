@@ -0,0 +1,143 @@
+#ifndef __HOST_ARDUINO_H__
+#define __HOST_ARDUINO_H__
+//============================================================================
+//
+// Just enough of <Arduino.h> to build the EVE library on a Linux host,
+// with EVE_SPI_TRANSPORT set to EVE_SPI_SPIDEV or EVE_SPI_RECORD. See
+// EVE_spi.h. Not used by the Arduino build.
+//
+// Crystalfontz America, Inc.
+// https://www.crystalfontz.com/products/eve-accelerated-tft-displays.php
+//This is free and unencumbered software released into the public domain.
+//
+//Anyone is free to copy, modify, publish, use, compile, sell, or
+//distribute this software, either in source code form or as a compiled
+//binary, for any purpose, commercial or non-commercial, and by any
+//means.
+//
+//In jurisdictions that recognize copyright laws, the author or authors
+//of this software dedicate any and all copyright interest in the
+//software to the public domain. We make this dedication for the benefit
+//of the public at large and to the detriment of our heirs and
+//successors. We intend this dedication to be an overt act of
+//relinquishment in perpetuity of all present and future rights to this
+//software under copyright law.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+//EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+//OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+//ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+//OTHER DEALINGS IN THE SOFTWARE.
+//
+//For more information, please refer to <http://unlicense.org/>
+//============================================================================
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+//============================================================================
+// No separate flash address space on the host.
+#define PROGMEM
+#define PSTR(s)                 (s)
+#define pgm_read_byte(p)        (*(const uint8_t *)(p))
+#define pgm_read_word(p)        (*(const uint16_t *)(p))
+#define pgm_read_dword(p)       (*(const uint32_t *)(p))
+#define strcpy_P                strcpy
+#define strlen_P                strlen
+#define memcpy_P                memcpy
+#define vsnprintf_P             vsnprintf
+class __FlashStringHelper;
+#define F(s)                    ((const __FlashStringHelper *)(s))
+//============================================================================
+// Timing
+inline unsigned long micros(void)
+  {
+  struct timespec
+    now;
+  clock_gettime(CLOCK_MONOTONIC,&now);
+  return((unsigned long)now.tv_sec*1000000UL+now.tv_nsec/1000);
+  }
+inline unsigned long millis(void)
+  {
+  return(micros()/1000);
+  }
+inline void delayMicroseconds(unsigned int us)
+  {
+  struct timespec
+    wait;
+  wait.tv_sec=us/1000000;
+  wait.tv_nsec=(long)(us%1000000)*1000;
+  nanosleep(&wait,0);
+  }
+inline void delay(unsigned long ms)
+  {
+  while(0 != ms)
+    {
+    delayMicroseconds(1000);
+    ms--;
+    }
+  }
+//============================================================================
+// GPIO. The host has no EVE_PD_NOT or EVE_INT wired up, so these do
+// nothing. With spidev the driver owns CS#.
+#define INPUT                   (0)
+#define OUTPUT                  (1)
+#define INPUT_PULLUP            (2)
+#define LOW                     (0)
+#define HIGH                    (1)
+inline void pinMode(uint8_t pin, uint8_t mode)
+  {
+  (void)pin;
+  (void)mode;
+  }
+inline void digitalWrite(uint8_t pin, uint8_t value)
+  {
+  (void)pin;
+  (void)value;
+  }
+inline int digitalRead(uint8_t pin)
+  {
+  (void)pin;
+  return(HIGH);
+  }
+//============================================================================
+inline char *dtostrf(double value, signed char width, unsigned char precision,
+                     char *buffer)
+  {
+  sprintf(buffer,"%*.*f",width,precision,value);
+  return(buffer);
+  }
+//============================================================================
+// Serial goes to stdout / comes from nowhere.
+class Host_Serial
+  {
+  public:
+    void begin(unsigned long baud)
+      {
+      (void)baud;
+      }
+    void print(const char *text)
+      {
+      fputs(text,stdout);
+      }
+    void write(uint8_t data)
+      {
+      fputc(data,stdout);
+      }
+    int available(void)
+      {
+      return(0);
+      }
+    int read(void)
+      {
+      return(-1);
+      }
+  };
+static Host_Serial __attribute__((unused))
+  Serial;
+//============================================================================
+#endif // __HOST_ARDUINO_H__
@@ -0,0 +1,77 @@
+#ifndef __HOST_SPI_H__
+#define __HOST_SPI_H__
+//============================================================================
+//
+// Just enough of <SPI.h> for the sketch's setup() to build on a Linux
+// host. The EVE traffic goes through EVE_spi.cpp instead, so nothing here
+// touches any hardware.
+//
+// Crystalfontz America, Inc.
+// https://www.crystalfontz.com/products/eve-accelerated-tft-displays.php
+//This is free and unencumbered software released into the public domain.
+//
+//Anyone is free to copy, modify, publish, use, compile, sell, or
+//distribute this software, either in source code form or as a compiled
+//binary, for any purpose, commercial or non-commercial, and by any
+//means.
+//
+//In jurisdictions that recognize copyright laws, the author or authors
+//of this software dedicate any and all copyright interest in the
+//software to the public domain. We make this dedication for the benefit
+//of the public at large and to the detriment of our heirs and
+//successors. We intend this dedication to be an overt act of
+//relinquishment in perpetuity of all present and future rights to this
+//software under copyright law.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+//EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+//OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+//ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+//OTHER DEALINGS IN THE SOFTWARE.
+//
+//For more information, please refer to <http://unlicense.org/>
+//============================================================================
+#include <Arduino.h>
+//============================================================================
+#define MSBFIRST                (1)
+#define SPI_MODE0               (0)
+class SPISettings
+  {
+  public:
+    SPISettings(uint32_t clock, uint8_t bit_order, uint8_t data_mode)
+      {
+      (void)clock;
+      (void)bit_order;
+      (void)data_mode;
+      }
+  };
+//----------------------------------------------------------------------------
+class Host_SPI
+  {
+  public:
+    void begin(void)
+      {
+      }
+    void beginTransaction(SPISettings settings)
+      {
+      (void)settings;
+      }
+    void endTransaction(void)
+      {
+      }
+    uint8_t transfer(uint8_t data)
+      {
+      (void)data;
+      return(0);
+      }
+    void transfer(void *buffer, size_t count)
+      {
+      memset(buffer,0,count);
+      }
+  };
+static Host_SPI __attribute__((unused))
+  SPI;
+//============================================================================
+#endif // __HOST_SPI_H__
@@ -0,0 +1,98 @@
+//============================================================================
+//
+// Runs the sketch on a Linux host against the EVE_SPI_RECORD transport
+// (see EVE_spi.h), and prints the SPI traffic of each frame:
+//
+//   make -C host
+//   host/host_run [frames]
+//
+// loop() never returns, so the frames are counted off the CMD_SWAPs the
+// pretend coprocessor sees. With FRAME_SKIP, a skipped frame is added to
+// the next one.
+//
+// Crystalfontz America, Inc.
+// https://www.crystalfontz.com/products/eve-accelerated-tft-displays.php
+//This is free and unencumbered software released into the public domain.
+//
+//Anyone is free to copy, modify, publish, use, compile, sell, or
+//distribute this software, either in source code form or as a compiled
+//binary, for any purpose, commercial or non-commercial, and by any
+//means.
+//
+//In jurisdictions that recognize copyright laws, the author or authors
+//of this software dedicate any and all copyright interest in the
+//software to the public domain. We make this dedication for the benefit
+//of the public at large and to the detriment of our heirs and
+//successors. We intend this dedication to be an overt act of
+//relinquishment in perpetuity of all present and future rights to this
+//software under copyright law.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+//EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+//OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+//ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+//OTHER DEALINGS IN THE SOFTWARE.
+//
+//For more information, please refer to <http://unlicense.org/>
+//============================================================================
+#include <Arduino.h>
+#include <SPI.h>
+
+#include "CFA10099_defines.h"
+#include "EVE_defines.h"
+#include "EVE_spi.h"
+//============================================================================
+// From CFA10099.ino
+void setup(void);
+void loop(void);
+//============================================================================
+static uint32_t
+  Host_Frames;
+static uint32_t
+  Host_Frame;
+static uint32_t
+  Host_Total_Bytes;
+//----------------------------------------------------------------------------
+// Print what the frame that just ended cost, and stop after Host_Frames.
+static void Host_Frame_Done(void)
+  {
+  printf("frame %lu: %lu transactions, %lu bytes written, %lu bytes read\n",
+         (unsigned long)Host_Frame,
+         (unsigned long)EVE_SPI_Record_Transactions,
+         (unsigned long)EVE_SPI_Record_Bytes_Written,
+         (unsigned long)EVE_SPI_Record_Bytes_Read);
+  Host_Total_Bytes+=EVE_SPI_Record_Bytes_Written+EVE_SPI_Record_Bytes_Read;
+  Host_Frame++;
+  if(Host_Frames <= Host_Frame)
+    {
+    printf("average: %lu bytes per frame\n",
+           (unsigned long)(Host_Total_Bytes/Host_Frame));
+    exit(0);
+    }
+  EVE_SPI_Record_Clear();
+  }
+//============================================================================
+int main(int argc, char *argv[])
+  {
+  Host_Frames=(1 < argc)?strtoul(argv[1],0,0):10;
+  setup();
+  printf("setup(): %lu transactions, %lu bytes written, %lu bytes read\n",
+         (unsigned long)EVE_SPI_Record_Transactions,
+         (unsigned long)EVE_SPI_Record_Bytes_Written,
+         (unsigned long)EVE_SPI_Record_Bytes_Read);
+  if(0 == Host_Frames)
+    {
+    return(0);
+    }
+  //The first frame is counted from here.
+  Host_Frame=0;
+  Host_Total_Bytes=0;
+  EVE_SPI_Record_Clear();
+  EVE_SPI_Record_Swap_Hook=Host_Frame_Done;
+  //Never returns, Host_Frame_Done() ends the program.
+  loop();
+  return(0);
+  }
+//============================================================================
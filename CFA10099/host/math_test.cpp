@@ -0,0 +1,331 @@
+//============================================================================
+//
+// Host test of the fixed-point math (EVE_math.cpp), against the floating
+// point library:
+//
+//   make -C host test
+//
+// Checks the worst error of the sine and atan2 tables, that EVE_Sqrt() is
+// exact over the whole 32-bit range, and that the easing curves and
+// animations start and end where they should. host/Makefile also turns on
+// EVE_MATH_BENCHMARK, so the timings it prints on the debug console (on
+// stdout here) can be had by running ./math_test by hand. The results go
+// to stderr. Exits non-zero if anything is wrong.
+//
+// Crystalfontz America, Inc.
+// https://www.crystalfontz.com/products/eve-accelerated-tft-displays.php
+//This is free and unencumbered software released into the public domain.
+//
+//Anyone is free to copy, modify, publish, use, compile, sell, or
+//distribute this software, either in source code form or as a compiled
+//binary, for any purpose, commercial or non-commercial, and by any
+//means.
+//
+//In jurisdictions that recognize copyright laws, the author or authors
+//of this software dedicate any and all copyright interest in the
+//software to the public domain. We make this dedication for the benefit
+//of the public at large and to the detriment of our heirs and
+//successors. We intend this dedication to be an overt act of
+//relinquishment in perpetuity of all present and future rights to this
+//software under copyright law.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+//EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+//OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+//ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+//OTHER DEALINGS IN THE SOFTWARE.
+//
+//For more information, please refer to <http://unlicense.org/>
+//============================================================================
+#include <Arduino.h>
+#include <SPI.h>
+#include <math.h>
+
+// Definitions for our display.
+#include "CFA10099_defines.h"
+
+#include "EVE_defines.h"
+#include "EVE_spi.h"
+#include "EVE_base.h"
+#include "EVE_math.h"
+//============================================================================
+// The most the tables may be off by. EVE_math.h promises these.
+// Q1.15 units of sine and cosine
+#define TEST_SIN_WORST   (3)
+// 1/65536 of a circle
+#define TEST_ATAN2_WORST (2)
+static uint32_t
+  Test_Failures;
+#define TEST_CHECK(condition) \
+  _Test_Check((condition),#condition,__LINE__)
+static void _Test_Check(int ok, const char *condition, int line)
+  {
+  if(!ok)
+    {
+    if(Test_Failures < 20)
+      {
+      fprintf(stderr,"math_test.cpp:%d: failed: %s\n",line,condition);
+      }
+    Test_Failures++;
+    }
+  }
+//----------------------------------------------------------------------------
+static void Test_Keep_Worst(int32_t *worst, int32_t error)
+  {
+  if(error < 0)
+    {
+    error=-error;
+    }
+  if(*worst < error)
+    {
+    *worst=error;
+    }
+  }
+//----------------------------------------------------------------------------
+// Same sequence on every run, so a failure can be repeated.
+static uint32_t
+  Test_Seed=12345;
+static uint32_t Test_Random(void)
+  {
+  Test_Seed=Test_Seed*1103515245UL+12345UL;
+  return(Test_Seed);
+  }
+//============================================================================
+static void Test_Sin(void)
+  {
+  uint32_t
+    angle;
+  int32_t
+    error;
+  int32_t
+    worst;
+  worst=0;
+  for(angle=0;angle<65536;angle++)
+    {
+    error=EVE_Sin_Q15((uint16_t)angle)-
+          lround(sin(angle*(2*M_PI/65536))*32767.0);
+    Test_Keep_Worst(&worst,error);
+    error=EVE_Cos_Q15((uint16_t)angle)-
+          lround(cos(angle*(2*M_PI/65536))*32767.0);
+    Test_Keep_Worst(&worst,error);
+    }
+  fprintf(stderr,"  EVE_Sin_Q15(), EVE_Cos_Q15(): worst error %ld/32767\n",
+          (long)worst);
+  TEST_CHECK(worst <= TEST_SIN_WORST);
+  //The quarters land exactly.
+  TEST_CHECK(0 == EVE_Sin_Q15(0));
+  TEST_CHECK(32767 == EVE_Sin_Q15(EVE_DEGREES(90)));
+  TEST_CHECK(0 == EVE_Sin_Q15(EVE_DEGREES(180)));
+  TEST_CHECK(-32767 == EVE_Sin_Q15(EVE_DEGREES(270)));
+  }
+//----------------------------------------------------------------------------
+static int32_t Test_Atan2_Error(int16_t y, int16_t x)
+  {
+  int32_t
+    error;
+  //Compare the angles modulo a full circle.
+  error=(int16_t)(EVE_Atan2(y,x)-
+                  (uint16_t)lround(atan2(y,x)*(65536/(2*M_PI))));
+  return(error);
+  }
+//----------------------------------------------------------------------------
+static void Test_Atan2(void)
+  {
+  int32_t
+    x;
+  int32_t
+    y;
+  uint32_t
+    i;
+  int32_t
+    worst;
+  worst=0;
+  //Every direction close in, where the ratios are coarse.
+  for(x=-64;x<=64;x++)
+    {
+    for(y=-64;y<=64;y++)
+      {
+      if((0 != x)||(0 != y))
+        {
+        Test_Keep_Worst(&worst,Test_Atan2_Error(y,x));
+        }
+      }
+    }
+  //And all over the int16_t range.
+  for(i=0;i<1000000UL;i++)
+    {
+    x=(int16_t)(Test_Random()>>16);
+    y=(int16_t)(Test_Random()>>16);
+    if((0 != x)||(0 != y))
+      {
+      Test_Keep_Worst(&worst,Test_Atan2_Error(y,x));
+      }
+    }
+  Test_Keep_Worst(&worst,Test_Atan2_Error(-32768,-32768));
+  Test_Keep_Worst(&worst,Test_Atan2_Error(32767,-32768));
+  fprintf(stderr,"  EVE_Atan2(): worst error %ld/65536 of a circle\n",
+          (long)worst);
+  TEST_CHECK(worst <= TEST_ATAN2_WORST);
+  TEST_CHECK(0 == EVE_Atan2(0,0));
+  TEST_CHECK(0 == EVE_Atan2(0,100));
+  TEST_CHECK(EVE_DEGREES(90) == EVE_Atan2(100,0));
+  TEST_CHECK(EVE_DEGREES(180) == EVE_Atan2(0,-100));
+  TEST_CHECK(EVE_DEGREES(270) == EVE_Atan2(-100,0));
+  }
+//----------------------------------------------------------------------------
+// Rounded down: root*root <= value < (root+1)*(root+1)
+static uint8_t Test_Sqrt_OK(uint32_t value)
+  {
+  uint64_t
+    root;
+  root=EVE_Sqrt(value);
+  return((root*root <= value)&&(value < (root+1)*(root+1)));
+  }
+//----------------------------------------------------------------------------
+static void Test_Sqrt(void)
+  {
+  uint32_t
+    n;
+  uint32_t
+    wrong;
+  wrong=0;
+  //Each square, and either side of it, where an off by one would show.
+  for(n=0;n<65536;n++)
+    {
+    if(n != EVE_Sqrt(n*n))
+      {
+      wrong++;
+      }
+    if((0 != n)&&(n-1 != EVE_Sqrt(n*n-1)))
+      {
+      wrong++;
+      }
+    if(n != EVE_Sqrt(n*n+2*n))
+      {
+      wrong++;
+      }
+    }
+  for(n=0;n<1000000UL;n++)
+    {
+    if(!Test_Sqrt_OK(Test_Random()))
+      {
+      wrong++;
+      }
+    }
+  fprintf(stderr,"  EVE_Sqrt(): %lu wrong\n",(unsigned long)wrong);
+  TEST_CHECK(0 == wrong);
+  TEST_CHECK(65535 == EVE_Sqrt(0xFFFFFFFFUL));
+  TEST_CHECK(0 == EVE_Sqrt(0));
+  }
+//============================================================================
+static void Test_Ease(void)
+  {
+  uint8_t
+    curve;
+  uint32_t
+    t;
+  uint8_t
+    monotonic;
+  for(curve=EVE_EASE_LINEAR;curve<=EVE_EASE_SINE;curve++)
+    {
+    TEST_CHECK(0 == EVE_Ease(curve,0));
+    TEST_CHECK(65535 == EVE_Ease(curve,65535));
+    monotonic=1;
+    for(t=1;t<65536;t++)
+      {
+      if(EVE_Ease(curve,(uint16_t)t) < EVE_Ease(curve,(uint16_t)(t-1)))
+        {
+        monotonic=0;
+        }
+      }
+    TEST_CHECK(monotonic);
+    }
+  //Halfway is halfway for the symmetric ones.
+  TEST_CHECK(1 >= labs((int32_t)EVE_Ease(EVE_EASE_IN_OUT,0x8000)-0x8000));
+  TEST_CHECK(1 >= labs((int32_t)EVE_Ease(EVE_EASE_SINE,0x8000)-0x8000));
+  }
+//----------------------------------------------------------------------------
+// Run one animation to the end and past it. Every step has to move
+// towards to (or stay put), and not go past it.
+static void Test_Animation_Run(int32_t from,
+                               int32_t to,
+                               uint16_t frames,
+                               uint8_t curve)
+  {
+  EVE_Animation
+    animation;
+  int32_t
+    value;
+  int32_t
+    last;
+  uint16_t
+    step;
+  uint8_t
+    ok;
+  EVE_Animation_Start(&animation,from,to,frames,curve);
+  ok=1;
+  last=from;
+  for(step=0;step<frames;step++)
+    {
+    if(EVE_Animation_Done(&animation))
+      {
+      ok=0;
+      }
+    value=EVE_Animation_Step(&animation);
+    if((from < to)?((value < last)||(to < value)):
+                    ((last < value)||(value < to)))
+      {
+      ok=0;
+      }
+    last=value;
+    }
+  TEST_CHECK(ok);
+  //The last step lands exactly, and it stays there.
+  TEST_CHECK((0 == frames)||(to == last));
+  TEST_CHECK(EVE_Animation_Done(&animation));
+  TEST_CHECK(to == EVE_Animation_Step(&animation));
+  TEST_CHECK(EVE_Animation_Done(&animation));
+  }
+//----------------------------------------------------------------------------
+static void Test_Animation(void)
+  {
+  static const uint16_t
+    frames[]={0,1,2,3,60,1000,65535};
+  uint8_t
+    curve;
+  uint8_t
+    i;
+  for(curve=EVE_EASE_LINEAR;curve<=EVE_EASE_SINE;curve++)
+    {
+    for(i=0;i<sizeof(frames)/sizeof(frames[0]);i++)
+      {
+      Test_Animation_Run(0,65536,frames[i],curve);
+      Test_Animation_Run(100,-100,frames[i],curve);
+      Test_Animation_Run(-2000000000L,2000000000L,frames[i],curve);
+      Test_Animation_Run(7,7,frames[i],curve);
+      }
+    }
+  }
+//============================================================================
+int main(void)
+  {
+  fprintf(stderr,"Fixed-point math\n");
+  Test_Sin();
+  Test_Atan2();
+  Test_Sqrt();
+  Test_Ease();
+  Test_Animation();
+#if (0 != EVE_MATH_BENCHMARK)
+  EVE_Math_Benchmark();
+#endif // (0 != EVE_MATH_BENCHMARK)
+  if(0 != Test_Failures)
+    {
+    fprintf(stderr,"  FAILED: %lu checks\n",(unsigned long)Test_Failures);
+    return(1);
+    }
+  fprintf(stderr,"  passed\n");
+  return(0);
+  }
+//============================================================================
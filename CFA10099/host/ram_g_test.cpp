@@ -0,0 +1,373 @@
+//============================================================================
+//
+// Host test of the RAM_G allocator (EVE_ram_g.cpp). host/Makefile builds
+// it twice, for the 256K RAM_G of an FT80x and the 1M of an FT81x / BT81x:
+//
+//   make -C host test
+//
+// A fixed set of edge cases and the asset CRC checks (with a stand-in for
+// CMD_MEMCRC), then a long run of random allocations, frees and trims
+// checked against a shadow copy of what should be in use. The library's
+// own debug messages go to stdout, the results to stderr. Exits non-zero
+// if anything is wrong.
+//
+// Crystalfontz America, Inc.
+// https://www.crystalfontz.com/products/eve-accelerated-tft-displays.php
+//This is free and unencumbered software released into the public domain.
+//
+//Anyone is free to copy, modify, publish, use, compile, sell, or
+//distribute this software, either in source code form or as a compiled
+//binary, for any purpose, commercial or non-commercial, and by any
+//means.
+//
+//In jurisdictions that recognize copyright laws, the author or authors
+//of this software dedicate any and all copyright interest in the
+//software to the public domain. We make this dedication for the benefit
+//of the public at large and to the detriment of our heirs and
+//successors. We intend this dedication to be an overt act of
+//relinquishment in perpetuity of all present and future rights to this
+//software under copyright law.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+//EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+//MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+//OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+//ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+//OTHER DEALINGS IN THE SOFTWARE.
+//
+//For more information, please refer to <http://unlicense.org/>
+//============================================================================
+#include <Arduino.h>
+#include <SPI.h>
+
+// Definitions for our display.
+#include "CFA10099_defines.h"
+
+#include "EVE_defines.h"
+#include "EVE_spi.h"
+#include "EVE_base.h"
+#include "EVE_ram_g.h"
+//============================================================================
+// EVE_ram_g.cpp links against these from EVE_base.cpp. The library's
+// messages go to stdout, without the flash string formatting.
+void SerPrintFF(const __FlashStringHelper *fmt, ... )
+  {
+  va_list
+    args;
+  va_start(args, fmt );
+  vprintf((const char *)fmt,args);
+  va_end (args);
+  }
+//----------------------------------------------------------------------------
+// There is no EVE to ask, so the "CRC" is the address plus whatever
+// Test_CRC_Offset is set to. Test_CRC_Fault makes the MEMCRC fault the way
+// a real one does: the coprocessor is reset and *crc is not written.
+uint16_t
+  EVE_Copro_Resets;
+static uint32_t
+  Test_CRC_Offset;
+static uint8_t
+  Test_CRC_Fault;
+uint16_t Get_RAM_G_CRC(uint16_t FWol,
+                       uint32_t address,
+                       uint32_t length,
+                       uint32_t *crc)
+  {
+  (void)length;
+  if(0 != Test_CRC_Fault)
+    {
+    EVE_Copro_Resets++;
+    return(FWol);
+    }
+  *crc=address+Test_CRC_Offset;
+  return(FWol);
+  }
+//============================================================================
+#define TEST_RANDOM_STEPS (200000UL)
+static uint32_t
+  Test_Failures;
+#define TEST_CHECK(condition) \
+  _Test_Check((condition),#condition,__LINE__)
+static void _Test_Check(int ok, const char *condition, int line)
+  {
+  if(!ok)
+    {
+    if(Test_Failures < 20)
+      {
+      fprintf(stderr,"ram_g_test.cpp:%d: failed: %s\n",line,condition);
+      }
+    Test_Failures++;
+    }
+  }
+//----------------------------------------------------------------------------
+// Same sequence on every run, so a failure can be repeated.
+static uint32_t
+  Test_Seed=12345;
+static uint32_t Test_Random(uint32_t range)
+  {
+  Test_Seed=Test_Seed*1103515245UL+12345UL;
+  return((Test_Seed >> 8)%range);
+  }
+//============================================================================
+// What the test thinks is allocated, by slot.
+static struct
+  {
+  uint32_t address;
+  uint32_t length;
+  } Test_Block[EVE_RAM_G_BLOCKS];
+//----------------------------------------------------------------------------
+static void Test_Forget_All(void)
+  {
+  uint8_t
+    i;
+  EVE_RAM_G_Reset();
+  for(i=0;i<EVE_RAM_G_BLOCKS;i++)
+    {
+    Test_Block[i].address=EVE_RAM_G_NONE;
+    }
+  }
+//----------------------------------------------------------------------------
+// The shadow has to agree with what the allocator reports.
+static void Test_Check_Usage(void)
+  {
+  EVE_RAM_G_Usage
+    usage;
+  uint32_t
+    used;
+  uint8_t
+    blocks;
+  uint8_t
+    i;
+  used=0;
+  blocks=0;
+  for(i=0;i<EVE_RAM_G_BLOCKS;i++)
+    {
+    if(EVE_RAM_G_NONE != Test_Block[i].address)
+      {
+      used+=Test_Block[i].length;
+      blocks++;
+      }
+    }
+  EVE_RAM_G_Get_Usage(&usage);
+  TEST_CHECK(EVE_RAM_G_SIZE == usage.used+usage.free);
+  TEST_CHECK(used == usage.used);
+  TEST_CHECK(blocks == usage.blocks);
+  TEST_CHECK(usage.largest_free <= usage.free);
+  TEST_CHECK(EVE_RAM_G_Largest_Free(4) == usage.largest_free);
+  }
+//----------------------------------------------------------------------------
+// A new block has to be aligned, inside RAM_G, and clear of the others.
+static void Test_Check_New(uint8_t slot, uint8_t alignment)
+  {
+  uint32_t
+    address;
+  uint32_t
+    length;
+  uint8_t
+    i;
+  address=Test_Block[slot].address;
+  length=Test_Block[slot].length;
+  TEST_CHECK(0 == (address & (alignment-1)));
+  TEST_CHECK(0 == (length & 0x03));
+  TEST_CHECK(EVE_RAM_G <= address);
+  TEST_CHECK(address+length <= EVE_RAM_G+EVE_RAM_G_SIZE);
+  for(i=0;i<EVE_RAM_G_BLOCKS;i++)
+    {
+    if((i != slot) && (EVE_RAM_G_NONE != Test_Block[i].address))
+      {
+      TEST_CHECK((address+length <= Test_Block[i].address) ||
+                 (Test_Block[i].address+Test_Block[i].length <= address));
+      }
+    }
+  }
+//============================================================================
+static void Test_Edges(void)
+  {
+  uint32_t
+    address;
+  uint32_t
+    next;
+  uint8_t
+    i;
+  Test_Forget_All();
+  //Nothing to allocate is refused, and does not use up a block.
+  TEST_CHECK(EVE_RAM_G_NONE == EVE_RAM_G_Alloc(0,4));
+  Test_Check_Usage();
+
+  //All of it, and not a word more.
+  TEST_CHECK(EVE_RAM_G_NONE == EVE_RAM_G_Alloc(EVE_RAM_G_SIZE+1,4));
+  address=EVE_RAM_G_Alloc(EVE_RAM_G_SIZE,4);
+  TEST_CHECK(EVE_RAM_G == address);
+  TEST_CHECK(EVE_RAM_G_NONE == EVE_RAM_G_Alloc(4,4));
+  TEST_CHECK(0 == EVE_RAM_G_Largest_Free(4));
+
+  //Trim gives back the end, and rounds up to a word.
+  EVE_RAM_G_Trim(address,EVE_RAM_G_SIZE/2-3);
+  TEST_CHECK(EVE_RAM_G_SIZE/2 == EVE_RAM_G_Largest_Free(4));
+  //It cannot grow a block.
+  EVE_RAM_G_Trim(address,EVE_RAM_G_SIZE);
+  TEST_CHECK(EVE_RAM_G_SIZE/2 == EVE_RAM_G_Largest_Free(4));
+  //Trimming to nothing keeps a word.
+  EVE_RAM_G_Trim(address,0);
+  TEST_CHECK(EVE_RAM_G_SIZE-4 == EVE_RAM_G_Largest_Free(4));
+  next=EVE_RAM_G_Alloc(4,4);
+  TEST_CHECK(address+4 == next);
+  EVE_RAM_G_Free(next);
+  EVE_RAM_G_Free(address);
+  TEST_CHECK(EVE_RAM_G_SIZE == EVE_RAM_G_Largest_Free(4));
+
+  //Alignment skips ahead, and the skipped bytes are still free.
+  address=EVE_RAM_G_Alloc(4,4);
+  next=EVE_RAM_G_Alloc(4,16);
+  TEST_CHECK(EVE_RAM_G+16 == next);
+  TEST_CHECK(address+4 == EVE_RAM_G_Alloc(4,4));
+  Test_Forget_All();
+
+  //The table holds EVE_RAM_G_BLOCKS blocks.
+  for(i=0;i<EVE_RAM_G_BLOCKS;i++)
+    {
+    TEST_CHECK(EVE_RAM_G_NONE != EVE_RAM_G_Alloc(4,4));
+    }
+  TEST_CHECK(EVE_RAM_G_NONE == EVE_RAM_G_Alloc(4,4));
+  Test_Forget_All();
+
+  //Freeing something that is not there leaves the rest alone.
+  address=EVE_RAM_G_Alloc(64,4);
+  EVE_RAM_G_Free(address+4);
+  EVE_RAM_G_Trim(address+4,4);
+  TEST_CHECK(EVE_RAM_G_SIZE-64 == EVE_RAM_G_Largest_Free(4));
+  Test_Forget_All();
+  }
+//============================================================================
+static void Test_Random_Steps(void)
+  {
+  uint32_t
+    step;
+  uint32_t
+    allocated;
+  uint32_t
+    refused;
+  uint8_t
+    slot;
+  uint8_t
+    alignment;
+  uint32_t
+    length;
+  uint32_t
+    largest;
+  Test_Forget_All();
+  allocated=0;
+  refused=0;
+  for(step=0;step<TEST_RANDOM_STEPS;step++)
+    {
+    slot=(uint8_t)Test_Random(EVE_RAM_G_BLOCKS);
+    if(EVE_RAM_G_NONE != Test_Block[slot].address)
+      {
+      if(0 != Test_Random(4))
+        {
+        EVE_RAM_G_Free(Test_Block[slot].address);
+        Test_Block[slot].address=EVE_RAM_G_NONE;
+        }
+      else
+        {
+        //Give back a random part of the end.
+        length=Test_Random(Test_Block[slot].length+1);
+        EVE_RAM_G_Trim(Test_Block[slot].address,length);
+        length=(length+0x03)&0xFFFFFFFC;
+        Test_Block[slot].length=(0 == length)?4:length;
+        }
+      }
+    else
+      {
+      alignment=(uint8_t)(1 << Test_Random(5));
+      //Mostly small, sometimes most of RAM_G.
+      if(0 == Test_Random(8))
+        {
+        length=Test_Random(EVE_RAM_G_SIZE)+1;
+        }
+      else
+        {
+        length=Test_Random(EVE_RAM_G_SIZE/8)+1;
+        }
+      largest=EVE_RAM_G_Largest_Free(alignment);
+      Test_Block[slot].address=EVE_RAM_G_Alloc(length,alignment);
+      Test_Block[slot].length=(length+0x03)&0xFFFFFFFC;
+      if(EVE_RAM_G_NONE == Test_Block[slot].address)
+        {
+        //Only refused when it really does not fit.
+        TEST_CHECK(largest < Test_Block[slot].length);
+        refused++;
+        }
+      else
+        {
+        TEST_CHECK(Test_Block[slot].length <= largest);
+        Test_Check_New(slot,alignment);
+        allocated++;
+        }
+      }
+    Test_Check_Usage();
+    }
+  fprintf(stderr,"  %lu steps, %lu allocated, %lu refused\n",
+          (unsigned long)TEST_RANDOM_STEPS,
+          (unsigned long)allocated,
+          (unsigned long)refused);
+  Test_Forget_All();
+  }
+//============================================================================
+static void Test_Assets(void)
+  {
+  EVE_RAM_G_Asset
+    asset=EVE_RAM_G_ASSET_NONE;
+  uint32_t
+    address;
+  Test_Forget_All();
+  //A failed load stays not loaded.
+  EVE_RAM_G_Asset_Loaded(0,&asset,EVE_RAM_G_NONE,64);
+  TEST_CHECK(!EVE_RAM_G_Asset_Is_Loaded(&asset));
+
+  //Unchanged, it is still there.
+  address=EVE_RAM_G_Alloc(64,4);
+  EVE_RAM_G_Asset_Loaded(0,&asset,address,64);
+  TEST_CHECK(EVE_RAM_G_Asset_Is_Loaded(&asset));
+  EVE_RAM_G_Asset_Verify(0,&asset);
+  TEST_CHECK(address == asset.address);
+
+  //Changed, the block is given back.
+  Test_CRC_Offset=1;
+  EVE_RAM_G_Asset_Verify(0,&asset);
+  TEST_CHECK(!EVE_RAM_G_Asset_Is_Loaded(&asset));
+  TEST_CHECK(EVE_RAM_G_SIZE == EVE_RAM_G_Largest_Free(4));
+  Test_CRC_Offset=0;
+
+  //If the CRC cannot be read, it is not loaded either way.
+  address=EVE_RAM_G_Alloc(64,4);
+  EVE_RAM_G_Asset_Loaded(0,&asset,address,64);
+  Test_CRC_Fault=1;
+  EVE_RAM_G_Asset_Verify(0,&asset);
+  TEST_CHECK(!EVE_RAM_G_Asset_Is_Loaded(&asset));
+  TEST_CHECK(EVE_RAM_G_SIZE == EVE_RAM_G_Largest_Free(4));
+  address=EVE_RAM_G_Alloc(64,4);
+  EVE_RAM_G_Asset_Loaded(0,&asset,address,64);
+  TEST_CHECK(!EVE_RAM_G_Asset_Is_Loaded(&asset));
+  TEST_CHECK(EVE_RAM_G_SIZE == EVE_RAM_G_Largest_Free(4));
+  Test_CRC_Fault=0;
+  Test_Forget_All();
+  }
+//============================================================================
+int main(void)
+  {
+  fprintf(stderr,"RAM_G allocator, EVE_RAM_G_SIZE=%lu\n",
+          (unsigned long)EVE_RAM_G_SIZE);
+  Test_Edges();
+  Test_Assets();
+  Test_Random_Steps();
+  if(0 != Test_Failures)
+    {
+    fprintf(stderr,"  FAILED: %lu checks\n",(unsigned long)Test_Failures);
+    return(1);
+    }
+  fprintf(stderr,"  passed\n");
+  return(0);
+  }
+//============================================================================
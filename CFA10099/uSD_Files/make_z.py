@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+#=============================================================================
+#
+# Compress files for EVE_Inflate_File_to_RAM_G() (EVE_draw.cpp), which
+# streams them off the uSD into CMD_INFLATE.
+#
+#   python3 make_z.py CLOUDS.RAW SPLASH.RAW
+#
+# writes CLOUDS.Z and SPLASH.Z next to them. CMD_INFLATE takes a zlib
+# stream (header, deflate data, Adler-32), which is what zlib.compress()
+# makes. The SD library only knows 8.3 names, so keep the base name to 8
+# characters.
+#
+# Crystalfontz America, Inc.
+# https://www.crystalfontz.com/products/eve-accelerated-tft-displays.php
+#This is free and unencumbered software released into the public domain.
+#
+#Anyone is free to copy, modify, publish, use, compile, sell, or
+#distribute this software, either in source code form or as a compiled
+#binary, for any purpose, commercial or non-commercial, and by any
+#means.
+#
+#In jurisdictions that recognize copyright laws, the author or authors
+#of this software dedicate any and all copyright interest in the
+#software to the public domain. We make this dedication for the benefit
+#of the public at large and to the detriment of our heirs and
+#successors. We intend this dedication to be an overt act of
+#relinquishment in perpetuity of all present and future rights to this
+#software under copyright law.
+#
+#THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+#EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+#MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+#IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+#OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+#ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+#OTHER DEALINGS IN THE SOFTWARE.
+#
+#For more information, please refer to <http://unlicense.org/>
+#=============================================================================
+import os
+import sys
+import zlib
+
+def main(names):
+  if 0 == len(names):
+    print("usage: make_z.py FILE.RAW [FILE.RAW ...]")
+    return(1)
+  for name in names:
+    with open(name,"rb") as raw_file:
+      raw=raw_file.read()
+    z_name=os.path.splitext(name)[0]+".Z"
+    z=zlib.compress(raw,9)
+    with open(z_name,"wb") as z_file:
+      z_file.write(z)
+    print("%s: %d bytes -> %s: %d bytes (%d%%)"%
+          (name,len(raw),z_name,len(z),(100*len(z))//max(len(raw),1)))
+  return(0)
+
+if __name__ == "__main__":
+  sys.exit(main(sys.argv[1:]))